@@ -0,0 +1,274 @@
+#!/usr/bin/env python3
+# **************************************
+# Generator of the instruction decoders
+#
+# - Reads the ISA description (rv32i.isa and the extensions in C_ISA)
+# - Emits the lookup-table decoder of the C models (librv32i/decode_table.[ch])
+#   and the case-based decoder module of the RTL (decoder.sv, SV_ISA only)
+#
+# Author: Dongkyun Lim (sts08015@korea.ac.kr)
+#
+# **************************************
+
+import os
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+ALU_CONTROL = {"and": 0, "or": 1, "add": 2, "xor": 3, "andn": 4, "orn": 5, "sub": 6, "sll": 7, "srl": 8, "sra": 9,
+	"xnor": 10, "min": 11, "max": 12, "minu": 13, "maxu": 14, "rol": 15, "ror": 16, "sh1add": 17, "sh2add": 18,
+	"sh3add": 19, "rev8": 20, "orc.b": 21, "zext.h": 22, "unary": 23}
+IMM_FMT = ["-", "I", "S", "B", "J", "U", "shamt"]	# order of the IMM_* enum
+CLASS_FLAGS = ["rs1", "rs2", "alu_src", "mem_read", "mem_write", "mem_to_reg", "reg_write", "jump"]
+AMO_OPS = ["none", "lr", "sc", "swap", "add", "xor", "and", "or", "min", "max", "minu", "maxu"]	# order of the AMO_* enum
+VEC_OPS = ["none", "cfg", "load", "store", "add", "sub", "rsub", "and", "or", "xor", "merge", "seq", "sne", "sltu", "slt",
+	"sleu", "sle", "sgtu", "sgt", "sll", "srl", "sra", "redsum", "wxunary", "rxunary"]	# order of the VEC_* enum
+INST_FLAGS = ["slt", "shamt", "b0", "b1", "b2", "b3", "b4", "b5", "trap", "rs1", "reg_write"] + \
+	["amo." + op for op in AMO_OPS[1:]] + ["vec." + op for op in VEC_OPS[1:]]
+
+C_ISA = ["rv32i.isa", "rvb.isa", "rv32a.isa", "rvv.isa"]	# decoded by the C models
+SV_ISA = ["rv32i.isa"]				# decoded by the RTL
+
+
+def header(comment, files):
+	return comment % ("generated by isa/gen_decoder.py from " + " ".join("isa/" + f for f in files) + ", do not edit") + "\n"
+
+
+class Entry:
+	"""control signals of one decoder output"""
+
+	def __init__(self, cls, name, alu_control, flags):
+		self.name = name
+		self.alu_op = cls["alu_op"]
+		self.alu_control = alu_control
+		self.slt = int("slt" in flags)
+		self.branch = 0
+		for i in range(6):
+			if "b%d" % i in flags: self.branch |= 1 << i
+		if "jump" in cls["flags"]: self.branch |= 1 << 6
+		self.trap = int("trap" in flags)
+		self.amo = ([AMO_OPS.index(f[4:]) for f in flags if f.startswith("amo.")] or [0])[0]
+		self.vec = ([VEC_OPS.index(f[4:]) for f in flags if f.startswith("vec.")] or [0])[0]
+		self.imm = IMM_FMT.index("shamt") if "shamt" in flags else IMM_FMT.index(cls["imm"])
+		for f in CLASS_FLAGS[:-1]: setattr(self, f, int(f in cls["flags"] or f in flags))
+
+	def key(self):
+		return tuple(sorted(self.__dict__.items()))
+
+
+def bits(s, width):
+	"""'-' or a bit pattern with '-' as don't care bits -> None or (value, mask)"""
+	if s == "-": return None
+	if len(s) != width or s.strip("01-"): raise ValueError("bad %d-bit field %s" % (width, s))
+	return int(s.replace("-", "0"), 2), int("".join("0" if b == "-" else "1" for b in s), 2)
+
+
+def match(pattern, v):
+	return pattern is None or (v & pattern[1]) == pattern[0]
+
+
+def parse(paths):
+	classes, insts = {}, []
+	for path, n, line in [(p, n, l) for p in paths for n, l in enumerate(open(p), 1)]:
+		tok = line.split("#")[0].split()
+		if not tok: continue
+		try:
+			if tok[0] == "class":
+				name, opcode, alu_op, imm, ctl = tok[1:6]
+				for f in tok[6:]:
+					if f not in CLASS_FLAGS: raise ValueError("unknown flag " + f)
+				if imm not in IMM_FMT: raise ValueError("unknown immediate format " + imm)
+				classes[name] = {"opcode": None if opcode == "-" else int(opcode, 2), "alu_op": int(alu_op, 2),
+					"imm": imm, "alu_control": ALU_CONTROL[ctl], "flags": tok[6:]}
+			else:
+				name, cls, f3, f7, ctl = tok[:5]
+				for f in tok[5:]:
+					if f not in INST_FLAGS: raise ValueError("unknown flag " + f)
+				insts.append({"name": name, "class": classes[cls], "funct3": bits(f3, 3), "funct7": bits(f7, 7),
+					"alu_control": ALU_CONTROL[ctl], "flags": tok[5:]})
+		except (ValueError, KeyError) as e:
+			sys.exit("%s:%d: %s" % (path, n, e))
+	return classes, insts
+
+
+def build(classes, insts):
+	"""dense table indexed by {opcode, funct3}, funct7 subtables where funct7 selects the entry"""
+	by_opcode = {c["opcode"]: c for c in classes.values()}
+	unknown = by_opcode[None]
+	table, f7_tables = [], []
+
+	for opcode in range(128):
+		cls = by_opcode.get(opcode, unknown)
+		rows = [i for i in insts if i["class"] is cls] if cls is not unknown else []
+		default = Entry(cls, None, cls["alu_control"], [])
+		for funct3 in range(8):
+			hits = [i for i in rows if match(i["funct3"], funct3)]
+			if any(i["funct7"] is not None for i in hits):
+				sub = []
+				for funct7 in range(128):
+					hit = [i for i in hits if match(i["funct7"], funct7)]
+					sub.append(Entry(cls, hit[0]["name"], hit[0]["alu_control"], hit[0]["flags"]) if hit else default)
+				keys = [[e.key() for e in t] for t in f7_tables]
+				k = [e.key() for e in sub]
+				if k not in keys:
+					f7_tables.append(sub)
+					keys.append(k)
+				table.append(1 + keys.index(k))
+			elif hits:
+				table.append(Entry(cls, hits[0]["name"], hits[0]["alu_control"], hits[0]["flags"]))
+			else:
+				table.append(default)
+	return table, f7_tables
+
+
+def c_entry(e):
+	if isinstance(e, int): return "\t{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, %d, NULL }," % e	# funct7 subtable
+	imm = ["IMM_NONE", "IMM_I", "IMM_S", "IMM_B", "IMM_J", "IMM_U", "IMM_SHAMT"][e.imm]
+	name = '"%s"' % e.name if e.name else "NULL"
+	return "\t{ %d, %d, %d, 0x%02x, %d, %d, %d, %d, %d, %d, %d, %s, %d, AMO_%s, VEC_%s, %d, %s }," % (e.alu_op, e.alu_control,
+		e.slt, e.branch, e.alu_src, e.mem_read, e.mem_write, e.mem_to_reg, e.reg_write, e.rs1, e.rs2, imm, e.trap,
+		AMO_OPS[e.amo].upper(), VEC_OPS[e.vec].upper(), 0, name)
+
+
+def emit_c(table, f7_tables):
+	c_header = header("/* %s */", C_ISA)
+	h = [c_header, "#ifndef _DECODE_TABLE_H_", "#define _DECODE_TABLE_H_", "", "#include <stdint.h>", "#include <stddef.h>", "",
+		"// immediate formats",
+		"enum imm_fmt_t {", "\tIMM_NONE = 0,", "\tIMM_I,", "\tIMM_S,", "\tIMM_B,\t\t// offset >> 1", "\tIMM_J,\t\t// offset >> 1",
+		"\tIMM_U,", "\tIMM_SHAMT\t// 5-bit shift amount", "};", "",
+		"// A extension: memory operation of lr/sc/amo*", "enum amo_op_t {"] + ["\tAMO_%s%s" % (op.upper(),
+		" = 0," if i == 0 else ("" if i == len(AMO_OPS) - 1 else ",")) for i, op in enumerate(AMO_OPS)] + ["};", "",
+		"// Zve32x: operation of the vector unit (the operand form is funct3)", "enum vec_op_t {"] + ["\tVEC_%s%s" % (op.upper(),
+		" = 0," if i == 0 else ("" if i == len(VEC_OPS) - 1 else ",")) for i, op in enumerate(VEC_OPS)] + ["};", "",
+		"struct decode_entry {",
+		"\tuint8_t alu_op;", "\tuint8_t alu_control;", "\tuint8_t slt;", "\tuint8_t branch;\t\t// bit n drives branch[n]",
+		"\tuint8_t alu_src;", "\tuint8_t mem_read;", "\tuint8_t mem_write;", "\tuint8_t mem_to_reg;", "\tuint8_t reg_write;",
+		"\tuint8_t rs1;\t\t// reads rs1", "\tuint8_t rs2;\t\t// reads rs2", "\tuint8_t imm;\t\t// enum imm_fmt_t", "\tuint8_t trap;\t\t// ecall/ebreak", "\tuint8_t amo;\t\t// enum amo_op_t", "\tuint8_t vec;\t\t// enum vec_op_t",
+		"\tuint8_t f7;\t\t\t// nonzero: funct7 selects the entry in decode_f7_table[f7 - 1]",
+		"\tconst char* name;\t// mnemonic, NULL if the encoding isn't in the table", "};", "",
+		"#define DECODE_F7_NUM %d" % len(f7_tables),
+		"#define DECODE_INDEX(inst) ((((inst) & 0x7f) << 3) | (((inst) >> 12) & 0x7))\t// {opcode, funct3}", "",
+		"extern const struct decode_entry decode_table[128 * 8];",
+		"extern const struct decode_entry decode_f7_table[DECODE_F7_NUM][128];", "", "#endif", ""]
+
+	c = [c_header, '#include "decode_table.h"', "", "const struct decode_entry decode_table[128 * 8] = {"]
+	for i, e in enumerate(table):
+		if i % 8 == 0: c.append("\t// opcode 0x%02x" % (i >> 3))
+		c.append(c_entry(e))
+	c += ["};", "", "const struct decode_entry decode_f7_table[DECODE_F7_NUM][128] = {"]
+	for t in f7_tables:
+		c.append("\t{")
+		c += ["\t" + c_entry(e) for e in t]
+		c.append("\t},")
+	c += ["};", ""]
+
+	open(os.path.join(ROOT, "librv32i", "decode_table.h"), "w").write("\n".join(h))
+	open(os.path.join(ROOT, "librv32i", "decode_table.c"), "w").write("\n".join(c))
+
+
+def sv_bits(p, width):
+	if p is None: return "?" * width
+	return "".join("?" if not (p[1] >> b) & 1 else str((p[0] >> b) & 1) for b in range(width - 1, -1, -1))
+
+
+def sv_assign(e):
+	return "ctrl = {2'b%s, 4'd%d, 1'b%d, 7'b%s, 1'b%d, 1'b%d, 1'b%d, 1'b%d, 1'b%d, 1'b%d, 1'b%d, %s};" % (
+		format(e.alu_op, "02b"), e.alu_control, e.slt, format(e.branch, "07b"), e.alu_src, e.mem_read, e.mem_write,
+		e.mem_to_reg, e.reg_write, e.rs1, e.rs2, ["IMM_NONE", "IMM_I", "IMM_S", "IMM_B", "IMM_J", "IMM_U", "IMM_SHAMT"][e.imm])
+
+
+def emit_sv(classes, insts):
+	unknown = [c for c in classes.values() if c["opcode"] is None][0]
+	body = []
+	for cls in classes.values():
+		if cls is unknown: continue
+		for i in insts:
+			if i["class"] is not cls: continue
+			body.append("            17'b%s_%s_%s: %s   // %s" % (format(cls["opcode"], "07b"), sv_bits(i["funct3"], 3),
+				sv_bits(i["funct7"], 7), sv_assign(Entry(cls, i["name"], i["alu_control"], i["flags"])), i["name"]))
+		if any(i["class"] is cls and i["funct3"] is None and i["funct7"] is None for i in insts): continue	# already covered
+		body.append("            17'b%s_???_???????: %s" % (format(cls["opcode"], "07b"),
+			sv_assign(Entry(cls, None, cls["alu_control"], []))))
+	body.append("            default: %s" % sv_assign(Entry(unknown, None, unknown["alu_control"], [])))
+
+	sv = header("// %s", SV_ISA) + """/* ********************************************
+ *	Module: instruction decoder (decoder.sv)
+ *  - Main control unit, ALU control unit and immediate generator
+ *
+ *  Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * ********************************************
+ */
+
+`timescale 1ns/1ps
+
+module decoder
+(
+    input   [31:0]  inst,
+    output  [6:0]   opcode,
+    output  [2:0]   funct3,
+    output  [6:0]   funct7,
+    output  [4:0]   rs1,            // 0 if the instruction doesn't read rs1
+    output  [4:0]   rs2,            // 0 if the instruction doesn't read rs2
+    output  [4:0]   rd,
+    output  logic [31:0]  imm32,
+    output  [6:0]   branch,
+    output          alu_src,
+    output  [1:0]   alu_op,
+    output  [3:0]   alu_control,
+    output          slt,
+    output          mem_read,
+    output          mem_write,
+    output          mem_to_reg,
+    output          reg_write
+);
+
+    localparam IMM_NONE = 3'd0, IMM_I = 3'd1, IMM_S = 3'd2, IMM_B = 3'd3, IMM_J = 3'd4, IMM_U = 3'd5, IMM_SHAMT = 3'd6;
+
+    logic           use_rs1, use_rs2;
+    logic   [2:0]   imm;
+    logic   [23:0]  ctrl;
+
+    assign opcode = inst[6:0];
+    assign funct3 = inst[14:12];
+    assign funct7 = inst[31:25];
+
+    assign {alu_op, alu_control, slt, branch, alu_src, mem_read, mem_write, mem_to_reg, reg_write, use_rs1, use_rs2, imm} = ctrl;
+
+    always_comb begin
+        casez ({opcode, funct3, funct7})
+%s
+        endcase
+    end
+
+    assign rs1 = use_rs1 ? inst[19:15] : 5'd0;
+    assign rs2 = use_rs2 ? inst[24:20] : 5'd0;
+    assign rd = inst[11:7];
+
+    always_comb begin
+        case (imm)
+            IMM_I:      imm32 = {{20{inst[31]}}, inst[31:20]};
+            IMM_S:      imm32 = {{20{inst[31]}}, inst[31:25], inst[11:7]};
+            IMM_B:      imm32 = {{20{inst[31]}}, inst[31], inst[7], inst[30:25], inst[11:8]};
+            IMM_J:      imm32 = {{12{inst[31]}}, inst[31], inst[19:12], inst[20], inst[30:21]};
+            IMM_U:      imm32 = {{12{inst[31]}}, inst[31:12]};
+            IMM_SHAMT:  imm32 = {27'd0, inst[24:20]};
+            default:    imm32 = 32'd0;
+        endcase
+    end
+
+endmodule
+""" % "\n".join(body)
+	for d, nl in (("single_verilog", "\r\n"), ("pipeline_verilog", "\n")):	# line endings of the neighbouring sources
+		open(os.path.join(ROOT, d, "decoder.sv"), "w", newline=nl).write(sv)
+
+
+def main():
+	isa = lambda files: [os.path.join(ROOT, "isa", f) for f in files]
+	table, f7_tables = build(*parse(isa(C_ISA)))
+	emit_c(table, f7_tables)
+	emit_sv(*parse(isa(SV_ISA)))
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,140 @@
+/* **************************************
+ * Module: runtime configuration
+ *
+ * - Everything that used to be fixed at build time (memory sizes, run length)
+ *   and the pipeline behaviour the design-space sweeps vary
+ * - Files hold "key = value" lines, '#' starts a comment; the same keys
+ *   are accepted by rv32i_config_set (e.g. from command lines)
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+#include <ctype.h>
+#include <string.h>
+
+static const char* const stage_name[] = { "IF", "ID", "EX", "MEM", "WB" };
+
+void rv32i_config_init(struct rv32i_config* cfg, enum rv32i_engine engine)
+{
+	memset(cfg, 0, sizeof(*cfg));
+	cfg->engine = engine;
+	cfg->imem_depth = IMEM_DEPTH;
+	cfg->dmem_depth = DMEM_DEPTH;
+	cfg->max_cycles = 10000000000ULL;
+	cfg->forwarding = 1;
+	cfg->flush_opt = 1;
+	cfg->branch_stage = RV32I_STAGE_EX;
+	cfg->fusion = 1;
+}
+
+static int parse_u64(const char* value, uint64_t* out)
+{
+	char* end;
+	if (!isdigit((unsigned char)*value)) return 0;
+	*out = strtoull(value, &end, 0);
+	return *end == '\0';
+}
+
+static int parse_bool(const char* value, uint8_t* out)
+{
+	if (!strcmp(value, "1") || !strcmp(value, "on") || !strcmp(value, "true")) *out = 1;
+	else if (!strcmp(value, "0") || !strcmp(value, "off") || !strcmp(value, "false")) *out = 0;
+	else return 0;
+	return 1;
+}
+
+int rv32i_config_set(struct rv32i_config* cfg, const char* key, const char* value)
+{
+	uint64_t v;
+
+	if (!strcmp(key, "engine")) {
+		int e;
+		for (e = 0; e < RV32I_ENGINE_NUM && strcmp(rv32i_engine_name(e), value); e++);
+		if (e == RV32I_ENGINE_NUM) return RV32I_ERR_FORMAT;
+		cfg->engine = e;
+	}
+	else if (!strcmp(key, "imem_depth") || !strcmp(key, "dmem_depth")) {
+		// words, the byte address space must stay within 32 bits
+		if (!parse_u64(value, &v) || v == 0 || v > 0x40000000ULL) return RV32I_ERR_FORMAT;
+		if (key[0] == 'i') cfg->imem_depth = (uint32_t)v;
+		else cfg->dmem_depth = (uint32_t)v;
+	}
+	else if (!strcmp(key, "max_cycles")) {
+		if (!parse_u64(value, &v)) return RV32I_ERR_FORMAT;
+		cfg->max_cycles = v;
+	}
+	else if (!strcmp(key, "byte_lanes")) {
+		if (!parse_bool(value, &cfg->byte_lanes)) return RV32I_ERR_FORMAT;
+	}
+	else if (!strcmp(key, "vlen")) {
+		if (!parse_u64(value, &v) || (v != 0 && v != 128 && v != 256)) return RV32I_ERR_FORMAT;
+		cfg->vlen = (uint16_t)v;
+	}
+	else if (!strcmp(key, "forwarding")) {
+		if (!parse_bool(value, &cfg->forwarding)) return RV32I_ERR_FORMAT;
+	}
+	else if (!strcmp(key, "flush_opt")) {
+		if (!parse_bool(value, &cfg->flush_opt)) return RV32I_ERR_FORMAT;
+	}
+	else if (!strcmp(key, "fusion")) {
+		if (!parse_bool(value, &cfg->fusion)) return RV32I_ERR_FORMAT;
+	}
+	else if (!strcmp(key, "branch_stage")) {
+		int s;
+		for (s = RV32I_STAGE_ID; s <= RV32I_STAGE_MEM && strcmp(stage_name[s], value); s++);
+		if (s > RV32I_STAGE_MEM) return RV32I_ERR_FORMAT;
+		cfg->branch_stage = s;
+	}
+	else return RV32I_ERR_FORMAT;
+	return 0;
+}
+
+// strips leading and trailing blanks in place
+static char* trim(char* s)
+{
+	char* e;
+	while (isspace((unsigned char)*s)) s++;
+	for (e = s + strlen(s); e > s && isspace((unsigned char)e[-1]); e--);
+	*e = '\0';
+	return s;
+}
+
+int rv32i_config_load(struct rv32i_config* cfg, const char* file)
+{
+	FILE* fp;
+	char line[256];
+	int ret = 0;
+
+	if ((fp = fopen(file, "r")) == NULL) return RV32I_ERR_OPEN;
+	while (ret == 0 && fgets(line, sizeof(line), fp)) {
+		char* p = strchr(line, '#');
+		if (p) *p = '\0';
+		p = trim(line);
+		if (*p == '\0') continue;
+		char* eq = strchr(p, '=');
+		if (!eq) ret = RV32I_ERR_FORMAT;
+		else {
+			*eq = '\0';
+			ret = rv32i_config_set(cfg, trim(p), trim(eq + 1));
+		}
+	}
+	fclose(fp);
+	return ret;
+}
+
+void rv32i_config_write(const struct rv32i_config* cfg, FILE* fp)
+{
+	fprintf(fp, "engine = %s\n", rv32i_engine_name(cfg->engine));
+	fprintf(fp, "imem_depth = %u\n", cfg->imem_depth);
+	fprintf(fp, "dmem_depth = %u\n", cfg->dmem_depth);
+	fprintf(fp, "max_cycles = %llu\n", (unsigned long long)cfg->max_cycles);
+	fprintf(fp, "byte_lanes = %u\n", cfg->byte_lanes);
+	fprintf(fp, "vlen = %u\n", cfg->vlen);
+	fprintf(fp, "forwarding = %u\n", cfg->forwarding);
+	fprintf(fp, "flush_opt = %u\n", cfg->flush_opt);
+	fprintf(fp, "branch_stage = %s\n", stage_name[cfg->branch_stage]);
+	fprintf(fp, "fusion = %u\n", cfg->fusion);
+}
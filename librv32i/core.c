@@ -0,0 +1,442 @@
+/* **************************************
+ * Module: librv32i core handle
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+#include <string.h>
+
+static const struct rv32i_engine_ops* engines[RV32I_ENGINE_NUM] = {
+	&rv32i_single_ops,
+	&rv32i_pipeline_ops,
+	&rv32i_dual_ops,
+	&rv32i_ooo_ops,
+};
+
+rv32i_core* rv32i_create(enum rv32i_engine engine)
+{
+	struct rv32i_config cfg;
+	rv32i_config_init(&cfg, engine);
+	return rv32i_create_config(&cfg);
+}
+
+rv32i_core* rv32i_create_config(const struct rv32i_config* cfg)
+{
+	if (cfg->engine < 0 || cfg->engine >= RV32I_ENGINE_NUM || !cfg->imem_depth || !cfg->dmem_depth) return NULL;
+	if (cfg->byte_lanes && cfg->engine != RV32I_SINGLE && cfg->engine != RV32I_PIPELINE) return NULL;
+	if (cfg->vlen && cfg->engine != RV32I_SINGLE) return NULL;
+
+	rv32i_core* core = (rv32i_core*)calloc(1, sizeof(rv32i_core));
+	core->engine = cfg->engine;
+	core->ops = engines[cfg->engine];
+	core->cfg = *cfg;
+	core->state = calloc(1, core->ops->state_size);
+	core->reg_data = (uint32_t*)calloc(32, sizeof(uint32_t));
+	core->imem_data = (uint32_t*)calloc(core->cfg.imem_depth, sizeof(uint32_t));
+	core->dmem_data = (uint32_t*)calloc(core->cfg.dmem_depth, sizeof(uint32_t));
+	core->dmem_image = (uint32_t*)calloc(core->cfg.dmem_depth, sizeof(uint32_t));
+
+	rv32i_reset(core);
+	return core;
+}
+
+void rv32i_destroy(rv32i_core* core)
+{
+	if (!core) return;
+	if (core->ops->destroy) core->ops->destroy(core);
+	free(core->state);
+	free(core->reg_data);
+	free(core->imem_data);
+	free(core->dmem_data);
+	free(core->dmem_image);
+	free(core);
+}
+
+const char* rv32i_engine_name(enum rv32i_engine engine)
+{
+	if (engine < 0 || engine >= RV32I_ENGINE_NUM) return NULL;
+	return engines[engine]->name;
+}
+
+int rv32i_load_file(rv32i_core* core, enum rv32i_mem mem, const char* path)
+{
+	FILE* fp;
+	uint32_t d, buf, i = 0;
+	int k;
+
+	if ((fp = fopen(path, "r")) == NULL) return RV32I_ERR_OPEN;
+
+	if (mem == RV32I_IMEM) {	// 32 binary digits per word
+		while (i < core->cfg.imem_depth && fscanf(fp, "%1d", &buf) != EOF) {
+			d = buf << 31;
+			for (k = 30; k >= 0; k--) {
+				if (fscanf(fp, "%1d", &buf) != EOF) {
+					d |= buf << k;
+				}
+				else {
+					fclose(fp);
+					return RV32I_ERR_FORMAT;
+				}
+			}
+			core->imem_data[i++] = d;
+		}
+		core->entry = 0;
+		core->stack = 0;
+	}
+	else {	// 8 hex digits per word
+		while (i < core->cfg.dmem_depth && fscanf(fp, "%8x", &buf) != EOF) {
+			core->dmem_data[i] = buf;
+			core->dmem_image[i] = buf;
+			i++;
+		}
+		core->heap = i << 2;
+	}
+
+	fclose(fp);
+	rv32i_reset(core);
+	return i;
+}
+
+int rv32i_load_image(rv32i_core* core, const char* imem_file, const char* dmem_file)
+{
+	int ret;
+	if ((ret = rv32i_load_file(core, RV32I_IMEM, imem_file)) < 0) return ret;
+	if ((ret = rv32i_load_file(core, RV32I_DMEM, dmem_file)) < 0) return ret;
+	return 0;
+}
+
+void rv32i_load_words(rv32i_core* core, enum rv32i_mem mem, const uint32_t* words, uint32_t count)
+{
+	if (mem == RV32I_IMEM) {
+		if (count > core->cfg.imem_depth) count = core->cfg.imem_depth;
+		memcpy(core->imem_data, words, count * sizeof(uint32_t));
+		core->entry = 0;
+		core->stack = 0;
+	}
+	else {
+		if (count > core->cfg.dmem_depth) count = core->cfg.dmem_depth;
+		memcpy(core->dmem_data, words, count * sizeof(uint32_t));
+		memcpy(core->dmem_image, words, count * sizeof(uint32_t));
+		core->heap = count << 2;
+	}
+	rv32i_reset(core);
+}
+
+void rv32i_reset(rv32i_core* core)
+{
+	memset(core->reg_data, 0, 32 * sizeof(uint32_t));
+	core->reg_data[2] = core->stack;
+	memcpy(core->dmem_data, core->dmem_image, core->cfg.dmem_depth * sizeof(uint32_t));
+	core->cycle = 0;
+	core->retired = 0;
+	core->halted = 0;
+	core->ebreak = 0;
+	memset(core->charged, 0, sizeof(core->charged));
+	core->fused = 0;
+	core->resv.valid = 0;
+	memset(&core->vec, 0, sizeof(core->vec));
+	memset(core->host_ticks, 0, sizeof(core->host_ticks));
+	core->host_ns = 0;
+	if (core->prof) rv32i_prof_restart(core->prof);
+	if (core->view) rv32i_view_restart(core->view);
+
+	if (core->ops->destroy) core->ops->destroy(core);
+	memset(core->state, 0, core->ops->state_size);
+	core->ops->reset(core);
+	if (core->undo) rv32i_undo_restart(core->undo);
+}
+
+uint64_t rv32i_step(rv32i_core* core, uint64_t cycles)
+{
+	uint64_t n;
+	HOST_START(core);
+	for (n = 0; n < cycles && !core->halted; n++) {
+		core->ops->cycle(core);
+		core->cycle++;
+		if (core->undo) rv32i_undo_cycle(core->undo);
+	}
+	HOST_STOP(core);
+	return n;
+}
+
+uint64_t rv32i_run_until(rv32i_core* core, rv32i_pred pred, void* arg, uint64_t max_cycles)
+{
+	uint64_t n = 0;
+	HOST_START(core);
+	while (n < max_cycles && !core->halted) {
+		core->ops->cycle(core);
+		core->cycle++;
+		if (core->undo) rv32i_undo_cycle(core->undo);
+		n++;
+		if (pred && pred(core, arg)) break;
+	}
+	HOST_STOP(core);
+	return n;
+}
+
+uint32_t rv32i_get_pc(rv32i_core* core)
+{
+	return core->ops->pc(core);
+}
+
+uint32_t rv32i_get_reg(rv32i_core* core, int reg)
+{
+	return (reg > 0 && reg < 32) ? core->reg_data[reg] : 0;
+}
+
+void rv32i_set_reg(rv32i_core* core, int reg, uint32_t value)
+{
+	if (reg <= 0 || reg >= 32) return;
+	if (core->undo) {
+		rv32i_undo_reg(core->undo, reg);
+		rv32i_undo_edit(core->undo);
+	}
+	core->reg_data[reg] = value;
+}
+
+uint32_t rv32i_read_mem(rv32i_core* core, enum rv32i_mem mem, uint32_t addr)
+{
+	uint32_t idx = addr >> 2;
+	if (mem == RV32I_IMEM) return (idx < core->cfg.imem_depth) ? core->imem_data[idx] : 0;
+	return (idx < core->cfg.dmem_depth) ? core->dmem_data[idx] : 0;
+}
+
+void rv32i_write_mem(rv32i_core* core, enum rv32i_mem mem, uint32_t addr, uint32_t value)
+{
+	uint32_t idx = addr >> 2;
+	if (mem == RV32I_IMEM && idx < core->cfg.imem_depth) core->imem_data[idx] = value;
+	else if (mem == RV32I_DMEM && idx < core->cfg.dmem_depth) {
+		if (core->undo) {
+			rv32i_undo_mem(core->undo, idx);
+			rv32i_undo_edit(core->undo);
+		}
+		core->dmem_data[idx] = value;
+	}
+}
+
+uint64_t rv32i_get_cycles(rv32i_core* core)
+{
+	return core->cycle;
+}
+
+uint64_t rv32i_get_retired(rv32i_core* core)
+{
+	return core->retired;
+}
+
+void rv32i_get_stats(rv32i_core* core, struct rv32i_stats* stats)
+{
+	stats->cycles = core->cycle;
+	stats->retired = core->retired;
+	stats->stall = core->charged[CHARGE_STALL];
+	stats->flush = core->charged[CHARGE_FLUSH];
+	stats->idle = core->charged[CHARGE_IDLE];
+	stats->fused = core->fused;
+}
+
+const struct rv32i_config* rv32i_get_config(rv32i_core* core)
+{
+	return &core->cfg;
+}
+
+void rv32i_halt(rv32i_core* core)
+{
+	core->halted = 1;
+}
+
+int rv32i_halted(rv32i_core* core)
+{
+	return core->halted;
+}
+
+void rv32i_set_commit_cb(rv32i_core* core, rv32i_commit_cb cb, void* arg)
+{
+	core->commit_cb = cb;
+	core->commit_arg = arg;
+}
+
+void rv32i_set_mem_cb(rv32i_core* core, rv32i_mem_cb cb, void* arg)
+{
+	core->mem_cb = cb;
+	core->mem_arg = arg;
+}
+
+void rv32i_set_ecall_cb(rv32i_core* core, rv32i_ecall_cb cb, void* arg)
+{
+	core->ecall_cb = cb;
+	core->ecall_arg = arg;
+}
+
+void rv32i_set_trace(rv32i_core* core, FILE* fp)
+{
+	core->trace = fp;
+}
+
+void rv32i_show_state(rv32i_core* core)
+{
+	show_state(core->reg_data, core->dmem_data);
+}
+
+int rv32i_report(rv32i_core* core, FILE* fp)
+{
+	return core->ops->report ? core->ops->report(core, fp) : 0;
+}
+
+void rv32i_core_commit(rv32i_core* core, uint32_t pc, uint8_t rd, uint8_t reg_write, uint32_t rd_din)
+{
+	uint32_t inst = ((pc >> 2) < core->cfg.imem_depth) ? core->imem_data[pc >> 2] : 0;
+	if (inst == 0) return;	//all-zero words aren't part of the program
+
+	core->retired++;
+	if (core->prof) rv32i_prof_commit(core->prof, pc, inst);
+	if (core->commit_cb) {
+		int prev = HOST_ENTER(core, HOST_IO);
+		struct rv32i_commit commit = { core->cycle, pc, inst, rd, reg_write, rd_din };
+		core->commit_cb(core->commit_arg, &commit);
+		HOST_LEAVE(core, prev);
+	}
+}
+
+void rv32i_core_mem(rv32i_core* core, uint32_t pc, uint32_t addr, uint32_t data, uint8_t write)
+{
+	if (core->mem_cb) {
+		int prev = HOST_ENTER(core, HOST_IO);
+		struct rv32i_mem_access access = { core->cycle, pc, addr, data, write };
+		core->mem_cb(core->mem_arg, &access);
+		HOST_LEAVE(core, prev);
+	}
+}
+
+void rv32i_core_trap(rv32i_core* core, uint32_t pc, uint32_t imm32)
+{
+	if (imm32 == 1) {	//ebreak
+		core->halted = 1;
+		core->ebreak = 1;
+		core->ebreak_pc = pc;
+	}
+	else if (core->ecall_cb) {	//ecall without a handler is a nop
+		int prev = HOST_ENTER(core, HOST_IO);
+		if (core->undo) rv32i_undo_ecall(core->undo, 0);
+		core->ecall_cb(core->ecall_arg, core, pc);
+		if (core->undo) rv32i_undo_ecall(core->undo, 1);
+		HOST_LEAVE(core, prev);
+	}
+}
+
+// the engines only keep instructions that haven't changed the architectural state
+// once a trap drained the older ones, so a stopped core can be restarted anywhere
+void rv32i_core_restart(rv32i_core* core, uint32_t pc)
+{
+	uint32_t entry = core->entry;
+
+	if (core->undo) rv32i_undo_pc(core->undo, pc);
+	if (core->ops->destroy) core->ops->destroy(core);
+	memset(core->state, 0, core->ops->state_size);
+	core->entry = pc;
+	core->ops->reset(core);
+	core->entry = entry;
+	core->halted = 0;
+	core->ebreak = 0;
+}
+
+static void resv_lock(rv32i_core* core)
+{
+	if (core->smp) pthread_mutex_lock(&core->smp->resv_lock);
+}
+
+static void resv_unlock(rv32i_core* core)
+{
+	if (core->smp) pthread_mutex_unlock(&core->smp->resv_lock);
+}
+
+// drop the reservations other harts hold on dmem word idx (resv_lock held)
+static void resv_clear(rv32i_core* core, uint32_t idx)
+{
+	rv32i_smp* smp = core->smp;
+	if (!smp) return;
+	for (int h = 0; h < smp->harts; h++) {
+		struct rv32i_resv* resv = &smp->hart[h]->resv;
+		if (h != core->hart && resv->valid && resv->idx == idx) {
+			resv->valid = 0;
+			__atomic_sub_fetch(&smp->resv_count, 1, __ATOMIC_SEQ_CST);
+		}
+	}
+}
+
+uint32_t rv32i_core_amo(rv32i_core* core, uint32_t pc, uint32_t addr, uint32_t rs2_dout, uint8_t amo)
+{
+	uint32_t idx = addr >> 2, old, new;
+	if (idx >= core->cfg.dmem_depth && amo != AMO_SC) return 0;	// outside dmem: reads 0, writes are dropped
+	uint32_t* word = (idx < core->cfg.dmem_depth) ? &core->dmem_data[idx] : NULL;	// NULL: an sc outside dmem, which fails
+	if (core->undo) {
+		if (amo == AMO_LR || amo == AMO_SC) rv32i_undo_resv(core->undo);
+		if (amo != AMO_LR && word) rv32i_undo_mem(core->undo, idx);
+	}
+
+	if (amo == AMO_LR) {
+		old = __atomic_load_n(word, __ATOMIC_SEQ_CST);
+		resv_lock(core);
+		if (!core->resv.valid && core->smp) __atomic_add_fetch(&core->smp->resv_count, 1, __ATOMIC_SEQ_CST);
+		core->resv.valid = 1;
+		core->resv.idx = idx;
+		core->resv.value = old;
+		resv_unlock(core);
+		rv32i_core_mem(core, pc, addr, old, 0);
+		return old;
+	}
+
+	if (amo == AMO_SC) {	// the compare-and-swap also catches a racing plain store that hasn't snooped yet
+		resv_lock(core);
+		old = core->resv.value;
+		int ok = word && core->resv.valid && core->resv.idx == idx &&
+			__atomic_compare_exchange_n(word, &old, rs2_dout, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+		if (core->resv.valid && core->smp) __atomic_sub_fetch(&core->smp->resv_count, 1, __ATOMIC_SEQ_CST);
+		core->resv.valid = 0;
+		if (ok) resv_clear(core, idx);
+		resv_unlock(core);
+		if (ok) rv32i_core_mem(core, pc, addr, rs2_dout, 1);
+		return !ok;
+	}
+
+	old = __atomic_load_n(word, __ATOMIC_SEQ_CST);
+	do {
+		new = amo_data(amo, old, rs2_dout);
+	} while (!__atomic_compare_exchange_n(word, &old, new, 1, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+	rv32i_core_snoop(core, addr);
+	rv32i_core_mem(core, pc, addr, new, 1);
+	return old;
+}
+
+void rv32i_core_snoop(rv32i_core* core, uint32_t addr)
+{
+	if (!core->smp || !__atomic_load_n(&core->smp->resv_count, __ATOMIC_SEQ_CST)) return;
+	resv_lock(core);
+	resv_clear(core, addr >> 2);
+	resv_unlock(core);
+}
+
+// the word at addr shifted down to it, with the bytes of the next word above when size bytes cross into it,
+// like the lanes of the RTL: load_data() extends the low bytes, words outside dmem read 0
+uint32_t rv32i_core_load_lanes(rv32i_core* core, uint32_t addr, int size)
+{
+	uint32_t idx = addr >> 2, shift = (addr & 3) * 8;
+	uint32_t dout = (idx < core->cfg.dmem_depth) ? core->dmem_data[idx] >> shift : 0;
+	if (LANES_CROSS(addr, size) && idx + 1 < core->cfg.dmem_depth) dout |= core->dmem_data[idx + 1] << (32 - shift);
+	return dout;
+}
+
+// the size low bytes of value to addr, bytes outside dmem are dropped
+void rv32i_core_store_lanes(rv32i_core* core, uint32_t addr, int size, uint32_t value)
+{
+	if (core->undo) {
+		rv32i_undo_mem(core->undo, addr >> 2);
+		if (LANES_CROSS(addr, size)) rv32i_undo_mem(core->undo, (addr >> 2) + 1);
+	}
+	for (int i = 0; i < size; i++) {
+		uint32_t idx = (addr + i) >> 2, shift = ((addr + i) & 3) * 8;
+		if (idx < core->cfg.dmem_depth) core->dmem_data[idx] = (core->dmem_data[idx] & ~(0xffu << shift)) | ((value >> 8 * i & 0xff) << shift);
+	}
+}
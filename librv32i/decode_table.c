@@ -0,0 +1,4281 @@
+/* generated by isa/gen_decoder.py from isa/rv32i.isa isa/rvb.isa isa/rv32a.isa isa/rvv.isa, do not edit */
+
+#include "decode_table.h"
+
+const struct decode_entry decode_table[128 * 8] = {
+	// opcode 0x00
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x01
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x02
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x03
+	{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "lb" },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "lh" },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "lw" },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "lbu" },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "lhu" },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x04
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x05
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x06
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x07
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 1, NULL },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 2, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 3, NULL },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x08
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x09
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x0a
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x0b
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x0c
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x0d
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x0e
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x0f
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x10
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x11
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x12
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x13
+	{ 3, 2, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "addi" },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 4, NULL },
+	{ 3, 6, 1, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "slti" },
+	{ 3, 6, 1, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "sltiu" },
+	{ 3, 3, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "xori" },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 5, NULL },
+	{ 3, 1, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "ori" },
+	{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "andi" },
+	// opcode 0x14
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x15
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x16
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x17
+	{ 0, 2, 0, 0x00, 1, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "auipc" },
+	{ 0, 2, 0, 0x00, 1, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "auipc" },
+	{ 0, 2, 0, 0x00, 1, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "auipc" },
+	{ 0, 2, 0, 0x00, 1, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "auipc" },
+	{ 0, 2, 0, 0x00, 1, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "auipc" },
+	{ 0, 2, 0, 0x00, 1, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "auipc" },
+	{ 0, 2, 0, 0x00, 1, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "auipc" },
+	{ 0, 2, 0, 0x00, 1, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "auipc" },
+	// opcode 0x18
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x19
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x1a
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x1b
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x1c
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x1d
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x1e
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x1f
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x20
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x21
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x22
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x23
+	{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 1, IMM_S, 0, AMO_NONE, VEC_NONE, 0, "sb" },
+	{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 1, IMM_S, 0, AMO_NONE, VEC_NONE, 0, "sh" },
+	{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 1, IMM_S, 0, AMO_NONE, VEC_NONE, 0, "sw" },
+	{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 1, IMM_S, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 1, IMM_S, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 1, IMM_S, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 1, IMM_S, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 1, IMM_S, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x24
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x25
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x26
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x27
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 6, NULL },
+	{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 7, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 8, NULL },
+	{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x28
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x29
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x2a
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x2b
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x2c
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x2d
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x2e
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x2f
+	{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 9, NULL },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x30
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x31
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x32
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x33
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 10, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 11, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 12, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 13, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 14, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 15, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 16, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 17, NULL },
+	// opcode 0x34
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x35
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x36
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x37
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "lui" },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "lui" },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "lui" },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "lui" },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "lui" },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "lui" },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "lui" },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 0, 0, IMM_U, 0, AMO_NONE, VEC_NONE, 0, "lui" },
+	// opcode 0x38
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x39
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x3a
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x3b
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x3c
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x3d
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x3e
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x3f
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x40
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x41
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x42
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x43
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x44
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x45
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x46
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x47
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x48
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x49
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x4a
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x4b
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x4c
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x4d
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x4e
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x4f
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x50
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x51
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x52
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x53
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x54
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x55
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x56
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x57
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 18, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 19, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 20, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 21, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 22, NULL },
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 23, NULL },
+	// opcode 0x58
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x59
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x5a
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x5b
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x5c
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x5d
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x5e
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x5f
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x60
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x61
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x62
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x63
+	{ 1, 6, 0, 0x01, 0, 0, 0, 0, 0, 1, 1, IMM_B, 0, AMO_NONE, VEC_NONE, 0, "beq" },
+	{ 1, 6, 0, 0x02, 0, 0, 0, 0, 0, 1, 1, IMM_B, 0, AMO_NONE, VEC_NONE, 0, "bne" },
+	{ 1, 6, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_B, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 1, 6, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_B, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 1, 6, 0, 0x04, 0, 0, 0, 0, 0, 1, 1, IMM_B, 0, AMO_NONE, VEC_NONE, 0, "blt" },
+	{ 1, 6, 0, 0x08, 0, 0, 0, 0, 0, 1, 1, IMM_B, 0, AMO_NONE, VEC_NONE, 0, "bge" },
+	{ 1, 6, 0, 0x10, 0, 0, 0, 0, 0, 1, 1, IMM_B, 0, AMO_NONE, VEC_NONE, 0, "bltu" },
+	{ 1, 6, 0, 0x20, 0, 0, 0, 0, 0, 1, 1, IMM_B, 0, AMO_NONE, VEC_NONE, 0, "bgeu" },
+	// opcode 0x64
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x65
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x66
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x67
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "jalr" },
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "jalr" },
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "jalr" },
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "jalr" },
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "jalr" },
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "jalr" },
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "jalr" },
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "jalr" },
+	// opcode 0x68
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x69
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x6a
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x6b
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x6c
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x6d
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x6e
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x6f
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 0, 0, IMM_J, 0, AMO_NONE, VEC_NONE, 0, "jal" },
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 0, 0, IMM_J, 0, AMO_NONE, VEC_NONE, 0, "jal" },
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 0, 0, IMM_J, 0, AMO_NONE, VEC_NONE, 0, "jal" },
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 0, 0, IMM_J, 0, AMO_NONE, VEC_NONE, 0, "jal" },
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 0, 0, IMM_J, 0, AMO_NONE, VEC_NONE, 0, "jal" },
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 0, 0, IMM_J, 0, AMO_NONE, VEC_NONE, 0, "jal" },
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 0, 0, IMM_J, 0, AMO_NONE, VEC_NONE, 0, "jal" },
+	{ 0, 2, 0, 0x40, 1, 0, 0, 0, 1, 0, 0, IMM_J, 0, AMO_NONE, VEC_NONE, 0, "jal" },
+	// opcode 0x70
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x71
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x72
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x73
+	{ 0, 0, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 24, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x74
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x75
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x76
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x77
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x78
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x79
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x7a
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x7b
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x7c
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x7d
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x7e
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	// opcode 0x7f
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+};
+
+const struct decode_entry decode_f7_table[DECODE_F7_NUM][128] = {
+	{
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_LOAD, 0, "vle8.v" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_LOAD, 0, "vle8.v" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_LOAD, 0, "vle16.v" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_LOAD, 0, "vle16.v" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_LOAD, 0, "vle32.v" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_LOAD, 0, "vle32.v" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 3, 7, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_SHAMT, 0, AMO_NONE, VEC_NONE, 0, "slli" },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 23, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_SHAMT, 0, AMO_NONE, VEC_NONE, 0, "clz.unary" },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 3, 8, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_SHAMT, 0, AMO_NONE, VEC_NONE, 0, "srli" },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 21, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "orc.b" },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 9, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_SHAMT, 0, AMO_NONE, VEC_NONE, 0, "srai" },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 16, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_SHAMT, 0, AMO_NONE, VEC_NONE, 0, "rori" },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 20, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, "rev8" },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 3, 0, 0, 0x00, 1, 0, 0, 0, 1, 1, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_STORE, 0, "vse8.v" },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_STORE, 0, "vse8.v" },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_STORE, 0, "vse16.v" },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_STORE, 0, "vse16.v" },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_STORE, 0, "vse32.v" },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_STORE, 0, "vse32.v" },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 0, 1, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_ADD, VEC_NONE, 0, "amoadd.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_ADD, VEC_NONE, 0, "amoadd.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_ADD, VEC_NONE, 0, "amoadd.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_ADD, VEC_NONE, 0, "amoadd.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_SWAP, VEC_NONE, 0, "amoswap.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_SWAP, VEC_NONE, 0, "amoswap.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_SWAP, VEC_NONE, 0, "amoswap.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_SWAP, VEC_NONE, 0, "amoswap.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_LR, VEC_NONE, 0, "lr.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_LR, VEC_NONE, 0, "lr.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_LR, VEC_NONE, 0, "lr.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_LR, VEC_NONE, 0, "lr.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_SC, VEC_NONE, 0, "sc.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_SC, VEC_NONE, 0, "sc.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_SC, VEC_NONE, 0, "sc.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_SC, VEC_NONE, 0, "sc.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_XOR, VEC_NONE, 0, "amoxor.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_XOR, VEC_NONE, 0, "amoxor.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_XOR, VEC_NONE, 0, "amoxor.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_XOR, VEC_NONE, 0, "amoxor.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_OR, VEC_NONE, 0, "amoor.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_OR, VEC_NONE, 0, "amoor.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_OR, VEC_NONE, 0, "amoor.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_OR, VEC_NONE, 0, "amoor.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_AND, VEC_NONE, 0, "amoand.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_AND, VEC_NONE, 0, "amoand.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_AND, VEC_NONE, 0, "amoand.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_AND, VEC_NONE, 0, "amoand.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MIN, VEC_NONE, 0, "amomin.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MIN, VEC_NONE, 0, "amomin.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MIN, VEC_NONE, 0, "amomin.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MIN, VEC_NONE, 0, "amomin.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MAX, VEC_NONE, 0, "amomax.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MAX, VEC_NONE, 0, "amomax.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MAX, VEC_NONE, 0, "amomax.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MAX, VEC_NONE, 0, "amomax.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MINU, VEC_NONE, 0, "amominu.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MINU, VEC_NONE, 0, "amominu.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MINU, VEC_NONE, 0, "amominu.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MINU, VEC_NONE, 0, "amominu.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MAXU, VEC_NONE, 0, "amomaxu.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MAXU, VEC_NONE, 0, "amomaxu.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MAXU, VEC_NONE, 0, "amomaxu.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_MAXU, VEC_NONE, 0, "amomaxu.w" },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 1, 1, 0, 1, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 2, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "add" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 6, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "sub" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 2, 7, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "sll" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 15, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "rol" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 2, 6, 1, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "slt" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 17, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "sh1add" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 2, 6, 1, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "sltu" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 2, 3, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "xor" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 22, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "zext.h" },
+		{ 2, 11, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "min" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 18, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "sh2add" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 10, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "xnor" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 2, 8, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "srl" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 13, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "minu" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 9, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "sra" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 16, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "ror" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 2, 1, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "or" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 12, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "max" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 19, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "sh3add" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 5, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "orn" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "and" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 14, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "maxu" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 4, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, "andn" },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 2, 0, 0, 0x00, 0, 0, 0, 0, 1, 1, 1, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_ADD, 0, "vadd.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_ADD, 0, "vadd.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SUB, 0, "vsub.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SUB, 0, "vsub.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_AND, 0, "vand.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_AND, 0, "vand.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_OR, 0, "vor.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_OR, 0, "vor.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_XOR, 0, "vxor.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_XOR, 0, "vxor.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_MERGE, 0, "vmerge.vvm" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_MERGE, 0, "vmerge.vvm" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SEQ, 0, "vmseq.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SEQ, 0, "vmseq.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SNE, 0, "vmsne.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SNE, 0, "vmsne.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLTU, 0, "vmsltu.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLTU, 0, "vmsltu.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLT, 0, "vmslt.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLT, 0, "vmslt.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLEU, 0, "vmsleu.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLEU, 0, "vmsleu.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLE, 0, "vmsle.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLE, 0, "vmsle.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLL, 0, "vsll.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLL, 0, "vsll.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SRL, 0, "vsrl.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SRL, 0, "vsrl.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SRA, 0, "vsra.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SRA, 0, "vsra.vv" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_REDSUM, 0, "vredsum.vs" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_REDSUM, 0, "vredsum.vs" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_WXUNARY, 0, "vwxunary0" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_WXUNARY, 0, "vwxunary0" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_ADD, 0, "vadd.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_ADD, 0, "vadd.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_RSUB, 0, "vrsub.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_RSUB, 0, "vrsub.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_AND, 0, "vand.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_AND, 0, "vand.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_OR, 0, "vor.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_OR, 0, "vor.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_XOR, 0, "vxor.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_XOR, 0, "vxor.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_MERGE, 0, "vmerge.vim" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_MERGE, 0, "vmerge.vim" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SEQ, 0, "vmseq.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SEQ, 0, "vmseq.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SNE, 0, "vmsne.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SNE, 0, "vmsne.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLEU, 0, "vmsleu.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLEU, 0, "vmsleu.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLE, 0, "vmsle.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLE, 0, "vmsle.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SGTU, 0, "vmsgtu.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SGTU, 0, "vmsgtu.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SGT, 0, "vmsgt.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SGT, 0, "vmsgt.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLL, 0, "vsll.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SLL, 0, "vsll.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SRL, 0, "vsrl.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SRL, 0, "vsrl.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SRA, 0, "vsra.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_SRA, 0, "vsra.vi" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_ADD, 0, "vadd.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_ADD, 0, "vadd.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SUB, 0, "vsub.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SUB, 0, "vsub.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_RSUB, 0, "vrsub.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_RSUB, 0, "vrsub.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_AND, 0, "vand.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_AND, 0, "vand.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_OR, 0, "vor.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_OR, 0, "vor.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_XOR, 0, "vxor.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_XOR, 0, "vxor.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_MERGE, 0, "vmerge.vxm" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_MERGE, 0, "vmerge.vxm" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SEQ, 0, "vmseq.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SEQ, 0, "vmseq.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SNE, 0, "vmsne.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SNE, 0, "vmsne.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SLTU, 0, "vmsltu.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SLTU, 0, "vmsltu.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SLT, 0, "vmslt.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SLT, 0, "vmslt.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SLEU, 0, "vmsleu.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SLEU, 0, "vmsleu.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SLE, 0, "vmsle.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SLE, 0, "vmsle.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SGTU, 0, "vmsgtu.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SGTU, 0, "vmsgtu.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SGT, 0, "vmsgt.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SGT, 0, "vmsgt.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SLL, 0, "vsll.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SLL, 0, "vsll.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SRL, 0, "vsrl.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SRL, 0, "vsrl.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SRA, 0, "vsra.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_SRA, 0, "vsra.vx" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_RXUNARY, 0, "vmv.s.x" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_RXUNARY, 0, "vmv.s.x" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 1, 1, 0, IMM_NONE, 0, AMO_NONE, VEC_CFG, 0, "vsetvli" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_NONE, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+	{
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 1, AMO_NONE, VEC_NONE, 0, "ecall" },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+		{ 0, 2, 0, 0x00, 0, 0, 0, 0, 0, 0, 0, IMM_I, 0, AMO_NONE, VEC_NONE, 0, NULL },
+	},
+};
@@ -0,0 +1,91 @@
+/* generated by isa/gen_decoder.py from isa/rv32i.isa isa/rvb.isa isa/rv32a.isa isa/rvv.isa, do not edit */
+
+#ifndef _DECODE_TABLE_H_
+#define _DECODE_TABLE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// immediate formats
+enum imm_fmt_t {
+	IMM_NONE = 0,
+	IMM_I,
+	IMM_S,
+	IMM_B,		// offset >> 1
+	IMM_J,		// offset >> 1
+	IMM_U,
+	IMM_SHAMT	// 5-bit shift amount
+};
+
+// A extension: memory operation of lr/sc/amo*
+enum amo_op_t {
+	AMO_NONE = 0,
+	AMO_LR,
+	AMO_SC,
+	AMO_SWAP,
+	AMO_ADD,
+	AMO_XOR,
+	AMO_AND,
+	AMO_OR,
+	AMO_MIN,
+	AMO_MAX,
+	AMO_MINU,
+	AMO_MAXU
+};
+
+// Zve32x: operation of the vector unit (the operand form is funct3)
+enum vec_op_t {
+	VEC_NONE = 0,
+	VEC_CFG,
+	VEC_LOAD,
+	VEC_STORE,
+	VEC_ADD,
+	VEC_SUB,
+	VEC_RSUB,
+	VEC_AND,
+	VEC_OR,
+	VEC_XOR,
+	VEC_MERGE,
+	VEC_SEQ,
+	VEC_SNE,
+	VEC_SLTU,
+	VEC_SLT,
+	VEC_SLEU,
+	VEC_SLE,
+	VEC_SGTU,
+	VEC_SGT,
+	VEC_SLL,
+	VEC_SRL,
+	VEC_SRA,
+	VEC_REDSUM,
+	VEC_WXUNARY,
+	VEC_RXUNARY
+};
+
+struct decode_entry {
+	uint8_t alu_op;
+	uint8_t alu_control;
+	uint8_t slt;
+	uint8_t branch;		// bit n drives branch[n]
+	uint8_t alu_src;
+	uint8_t mem_read;
+	uint8_t mem_write;
+	uint8_t mem_to_reg;
+	uint8_t reg_write;
+	uint8_t rs1;		// reads rs1
+	uint8_t rs2;		// reads rs2
+	uint8_t imm;		// enum imm_fmt_t
+	uint8_t trap;		// ecall/ebreak
+	uint8_t amo;		// enum amo_op_t
+	uint8_t vec;		// enum vec_op_t
+	uint8_t f7;			// nonzero: funct7 selects the entry in decode_f7_table[f7 - 1]
+	const char* name;	// mnemonic, NULL if the encoding isn't in the table
+};
+
+#define DECODE_F7_NUM 24
+#define DECODE_INDEX(inst) ((((inst) & 0x7f) << 3) | (((inst) >> 12) & 0x7))	// {opcode, funct3}
+
+extern const struct decode_entry decode_table[128 * 8];
+extern const struct decode_entry decode_f7_table[DECODE_F7_NUM][128];
+
+#endif
@@ -0,0 +1,335 @@
+/* **************************************
+ * Module: dual-issue in-order pipeline engine
+ *
+ * - Two-wide version of the pipeline engine (ISSUE_WIDTH lanes)
+ * - IF fetches two instructions, ID pairs them when there is no RAW/WAW
+ *   dependency or structural conflict (single dmem port, ALU_NUM ALUs)
+ * - 4-read/2-write register file, forwarding across both lanes
+ * - ecall/ebreak issue alone once the older instructions are done and trap from ID
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+#include <string.h>
+
+// reasons an issue slot in ID is left empty
+enum slot_loss_t {
+	LOSS_FETCH = 0,		// no instruction in the fetch buffer
+	LOSS_FLUSH,			// squashed by a taken branch
+	LOSS_LOAD_USE,		// operand is loaded by an instruction in EX
+	LOSS_RAW,			// reads rd of the older instruction in the pair
+	LOSS_WAW,			// writes the same rd as the older instruction in the pair
+	LOSS_MEM_PORT,		// both instructions access dmem
+	LOSS_ALU,			// not enough ALUs
+	LOSS_CONTROL,		// older instruction is a branch or jump
+	LOSS_TRAP,			// ecall/ebreak waiting for the older instructions, or the younger ones after it
+	LOSS_NUM
+};
+
+static const char* loss_name[LOSS_NUM] = {
+	"fetch", "flush", "load-use", "raw", "waw", "mem port", "alu", "control", "trap"
+};
+
+static uint8_t uses_alu(struct decoder_output_t* ctrl)
+{
+	return ctrl->opcode != 0x37 && ctrl->opcode != 0x6f;	//lui, jal only need adders
+}
+
+static uint8_t is_control(struct decoder_output_t* ctrl)
+{
+	int i;
+	for (i = 0; i < 7; i++) if (ctrl->branch[i]) return 1;
+	return 0;
+}
+
+static uint8_t reads_reg(struct decoder_output_t* ctrl, uint8_t rd)
+{
+	return rd != 0 && (ctrl->rs1 == rd || ctrl->rs2 == rd);
+}
+
+// forwarding unit: the youngest producer in MEM, then WB, wins
+static uint32_t forward(uint8_t rs, uint32_t rf_dout, lane_ex_mem* mem, lane_mem_wb* wb)
+{
+	int i;
+	if (rs == 0) return rf_dout;
+	for (i = ISSUE_WIDTH - 1; i >= 0; i--) {
+		if (mem[i].valid && mem[i].reg_write && !mem[i].mem_read && mem[i].rd == rs) return mem[i].rd_din;
+	}
+	for (i = ISSUE_WIDTH - 1; i >= 0; i--) {
+		if (wb[i].valid && wb[i].reg_write && wb[i].rd == rs) return wb[i].rd_din;
+	}
+	return rf_dout;
+}
+
+struct dual_state {
+	uint32_t fetch_pc;	// pc of the next instruction to fetch
+
+	struct imem_input_t imem_in;
+	struct rf_input_t regfile_in;
+	struct rf_output_t regfile_out;
+	struct dmem_input_t dmem_in;
+	struct dmem_output_t dmem_out;
+	struct decoder_input_t decoder_in;
+	struct exec_input_t exec_in;
+	struct exec_output_t exec_out;
+
+	// pipeline registers, indexed by lane
+	lane_if_id id[ISSUE_WIDTH];
+	lane_id_ex ex[ISSUE_WIDTH];
+	lane_ex_mem mem[ISSUE_WIDTH];
+	lane_mem_wb wb[ISSUE_WIDTH];
+
+	// next values of the pipeline registers
+	lane_if_id id_next[ISSUE_WIDTH];
+	lane_id_ex ex_next[ISSUE_WIDTH];
+	lane_ex_mem mem_next[ISSUE_WIDTH];
+	lane_mem_wb wb_next[ISSUE_WIDTH];
+
+	// statistics
+	uint64_t issue_hist[ISSUE_WIDTH + 1];	// cycles by number of instructions issued
+	uint64_t slot_loss[LOSS_NUM];
+	uint64_t flushes;
+	uint64_t last_retire;	// cycles until the last retirement
+};
+
+static void dual_reset(rv32i_core* core)
+{
+	struct dual_state* s = (struct dual_state*)core->state;
+
+	s->fetch_pc = core->entry;
+	s->imem_in.imem_data = core->imem_data;
+	s->regfile_in.rf_data = core->reg_data;
+	s->dmem_in.dmem_data = core->dmem_data;
+}
+
+static void dual_cycle(rv32i_core* core)
+{
+	struct dual_state* s = (struct dual_state*)core->state;
+	int i, k;
+
+	memset(s->id_next, 0, sizeof(s->id_next));
+	memset(s->ex_next, 0, sizeof(s->ex_next));
+	memset(s->mem_next, 0, sizeof(s->mem_next));
+	memset(s->wb_next, 0, sizeof(s->wb_next));
+
+	//WriteBack: two write ports
+	for (i = 0; i < ISSUE_WIDTH; i++) {
+		if (!s->wb[i].valid) continue;
+		s->regfile_in.rd = s->wb[i].rd;
+		s->regfile_in.rd_din = s->wb[i].rd_din;
+		s->regfile_in.reg_write = s->wb[i].reg_write;
+		regfile(s->regfile_in);
+		rv32i_core_commit(core, s->wb[i].pc, s->wb[i].rd, s->wb[i].reg_write, s->wb[i].rd_din);
+		s->last_retire = core->cycle + 1;
+	}
+	s->regfile_in.reg_write = 0;
+
+	//Memory: single dmem port, shared by the lanes
+	for (i = 0; i < ISSUE_WIDTH; i++) {
+		if (!s->mem[i].valid) continue;
+		s->wb_next[i].valid = 1;
+		s->wb_next[i].pc = s->mem[i].pc;
+		s->wb_next[i].rd = s->mem[i].rd;
+		s->wb_next[i].reg_write = s->mem[i].reg_write;
+		s->wb_next[i].rd_din = s->mem[i].rd_din;
+
+		if (s->mem[i].mem_read || s->mem[i].mem_write) {
+			s->dmem_in.addr = s->mem[i].alu_result >> 2; //32bit-dmem
+			s->dmem_in.din = s->mem[i].dmem_din;
+			s->dmem_in.mem_read = s->mem[i].mem_read && s->dmem_in.addr < core->cfg.dmem_depth;	// outside dmem: reads 0, writes are dropped
+			s->dmem_in.mem_write = s->mem[i].mem_write && s->dmem_in.addr < core->cfg.dmem_depth;
+			s->dmem_out = dmem(s->dmem_in);
+			if (s->mem[i].mem_read) s->wb_next[i].rd_din = load_data(s->mem[i].funct3, s->dmem_out.dout);
+			rv32i_core_mem(core, s->mem[i].pc, s->mem[i].alu_result, s->mem[i].mem_write ? s->dmem_in.din : s->dmem_out.dout, s->mem[i].mem_write);
+		}
+	}
+
+	//Execute: one ALU per lane
+	uint8_t redirect = 0;
+	uint32_t redirect_pc = 0;
+	for (i = 0; i < ISSUE_WIDTH; i++) {
+		if (!s->ex[i].valid) continue;
+
+		s->exec_in.pc = s->ex[i].pc;
+		s->exec_in.rs1_dout = forward(s->ex[i].ctrl.rs1, s->ex[i].rs1_dout, s->mem, s->wb);
+		s->exec_in.rs2_dout = forward(s->ex[i].ctrl.rs2, s->ex[i].rs2_dout, s->mem, s->wb);
+		s->exec_in.ctrl = s->ex[i].ctrl;
+		s->exec_out = execute(s->exec_in);
+
+		s->mem_next[i].valid = 1;
+		s->mem_next[i].pc = s->ex[i].pc;
+		s->mem_next[i].alu_result = s->exec_out.alu_result;
+		s->mem_next[i].rd_din = s->exec_out.rd_din;
+		s->mem_next[i].dmem_din = s->exec_out.dmem_din;
+		s->mem_next[i].mem_read = s->ex[i].ctrl.mem_read;
+		s->mem_next[i].mem_write = s->ex[i].ctrl.mem_write;
+		s->mem_next[i].funct3 = s->ex[i].ctrl.funct3;
+		s->mem_next[i].rd = s->ex[i].ctrl.rd;
+		s->mem_next[i].reg_write = s->ex[i].ctrl.reg_write;
+
+		// branch target isn't the next instruction -> flush younger ones
+		if (s->exec_out.branch_taken && s->exec_out.branch_target != s->ex[i].pc + 4) {
+			redirect = 1;
+			redirect_pc = s->exec_out.branch_target;
+		}
+	}
+
+	//Instruction Decode: pair check, hazard detection, 4-read regfile
+	struct decoder_output_t ctrl[ISSUE_WIDTH];
+	int issued = 0;
+	int alu_used = 0;
+	uint8_t mem_used = 0;
+	uint8_t loss = LOSS_FETCH;
+
+	for (i = 0; i < ISSUE_WIDTH; i++) {
+		if (redirect) {
+			loss = LOSS_FLUSH;
+			break;
+		}
+		if (!s->id[i].valid) {
+			loss = LOSS_FETCH;
+			break;
+		}
+
+		s->decoder_in.inst = s->id[i].inst;
+		ctrl[i] = decoder(s->decoder_in);
+		VEC_NOP(ctrl[i]);
+
+		// ecall/ebreak: oldest of the group, and nothing older left in EX or MEM
+		if (ctrl[i].trap) {
+			for (k = 0; k < ISSUE_WIDTH && !s->ex[k].valid && !s->mem[k].valid; k++);
+			if (i > 0 || k < ISSUE_WIDTH) {
+				loss = LOSS_TRAP;
+				break;
+			}
+		}
+
+		// load-use against both EX lanes
+		for (k = 0; k < ISSUE_WIDTH; k++) {
+			if (s->ex[k].valid && s->ex[k].ctrl.mem_read && reads_reg(&ctrl[i], s->ex[k].ctrl.rd)) break;
+		}
+		if (k < ISSUE_WIDTH) {
+			loss = LOSS_LOAD_USE;
+			break;
+		}
+
+		// pairing rules against the older instructions of this group
+		for (k = 0; k < i; k++) {
+			if (ctrl[k].reg_write && reads_reg(&ctrl[i], ctrl[k].rd)) {
+				loss = LOSS_RAW;
+				break;
+			}
+			if (ctrl[k].reg_write && ctrl[i].reg_write && ctrl[k].rd == ctrl[i].rd && ctrl[i].rd != 0) {
+				loss = LOSS_WAW;
+				break;
+			}
+			if (is_control(&ctrl[k])) {
+				loss = LOSS_CONTROL;
+				break;
+			}
+			if (ctrl[k].trap) {
+				loss = LOSS_TRAP;
+				break;
+			}
+		}
+		if (k < i) break;
+		if (mem_used && (ctrl[i].mem_read || ctrl[i].mem_write)) {
+			loss = LOSS_MEM_PORT;
+			break;
+		}
+		if (uses_alu(&ctrl[i]) && alu_used == ALU_NUM) {
+			loss = LOSS_ALU;
+			break;
+		}
+
+		mem_used |= ctrl[i].mem_read || ctrl[i].mem_write;
+		alu_used += uses_alu(&ctrl[i]);
+
+		if (ctrl[i].trap) rv32i_core_trap(core, s->id[i].pc, ctrl[i].imm32);
+
+		s->regfile_in.rs1 = ctrl[i].rs1;
+		s->regfile_in.rs2 = ctrl[i].rs2;
+		s->regfile_out = regfile(s->regfile_in);
+
+		s->ex_next[i].valid = 1;
+		s->ex_next[i].pc = s->id[i].pc;
+		s->ex_next[i].rs1_dout = s->regfile_out.rs1_dout;
+		s->ex_next[i].rs2_dout = s->regfile_out.rs2_dout;
+		s->ex_next[i].ctrl = ctrl[i];
+		issued++;
+	}
+
+	// don't count the idle cycles after the program has drained
+	uint8_t busy = 0;
+	for (i = 0; i < ISSUE_WIDTH; i++) busy |= s->id[i].valid | s->ex[i].valid | s->mem[i].valid | s->wb[i].valid;
+	if (busy) {
+		s->issue_hist[issued]++;
+		s->slot_loss[loss] += ISSUE_WIDTH - issued;
+	}
+
+	//Fetch: refill the fetch buffer behind the instructions that weren't issued
+	if (redirect) {
+		s->fetch_pc = redirect_pc;
+		s->flushes++;
+		k = 0;
+	}
+	else {
+		k = 0;
+		for (i = issued; i < ISSUE_WIDTH; i++) if (s->id[i].valid) s->id_next[k++] = s->id[i];
+	}
+
+	for (; k < ISSUE_WIDTH; k++) {
+		s->imem_in.addr = s->fetch_pc >> 2;
+		s->id_next[k].pc = s->fetch_pc;
+		s->id_next[k].inst = (s->imem_in.addr < core->cfg.imem_depth) ? imem(s->imem_in).dout : 0;
+		s->id_next[k].valid = (s->id_next[k].inst != 0);	//all-zero words aren't part of the program
+		s->fetch_pc += 4;
+	}
+
+	memcpy(s->id, s->id_next, sizeof(s->id));
+	memcpy(s->ex, s->ex_next, sizeof(s->ex));
+	memcpy(s->mem, s->mem_next, sizeof(s->mem));
+	memcpy(s->wb, s->wb_next, sizeof(s->wb));
+}
+
+static uint32_t dual_pc(rv32i_core* core)
+{
+	struct dual_state* s = (struct dual_state*)core->state;
+	int i;
+	for (i = 0; i < ISSUE_WIDTH; i++) if (s->id[i].valid) return s->id[i].pc;	// oldest instruction waiting in ID
+	return s->fetch_pc;
+}
+
+static int dual_report(rv32i_core* core, FILE* fp)
+{
+	struct dual_state* s = (struct dual_state*)core->state;
+	uint64_t cycles = s->last_retire;
+	uint64_t retired = core->retired;
+	uint64_t issue_cycles = 0;
+	int i;
+	for (i = 1; i <= ISSUE_WIDTH; i++) issue_cycles += s->issue_hist[i];
+
+	fputs("\nDUAL-ISSUE STATS\n", fp);
+	fprintf(fp, "cycles (to last retire): %llu\n", (unsigned long long)cycles);
+	fprintf(fp, "instructions retired   : %llu\n", (unsigned long long)retired);
+	fprintf(fp, "IPC                    : %.3f\n", cycles ? (double)retired / cycles : 0.0);
+	for (i = 0; i <= ISSUE_WIDTH; i++) fprintf(fp, "cycles issuing %d       : %llu\n", i, (unsigned long long)s->issue_hist[i]);
+	fprintf(fp, "pairing rate           : %.1f%% of issuing cycles\n", issue_cycles ? 100.0 * s->issue_hist[ISSUE_WIDTH] / issue_cycles : 0.0);
+	fprintf(fp, "taken-branch flushes   : %llu\n", (unsigned long long)s->flushes);
+	fputs("lost issue slots:\n", fp);
+	for (i = 0; i < LOSS_NUM; i++) fprintf(fp, "  %-9s: %llu\n", loss_name[i], (unsigned long long)s->slot_loss[i]);
+	return 0;
+}
+
+const struct rv32i_engine_ops rv32i_dual_ops = {
+	"dual",
+	sizeof(struct dual_state),
+	dual_reset,
+	dual_cycle,
+	dual_pc,
+	dual_report,
+	NULL,
+};
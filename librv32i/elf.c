@@ -0,0 +1,233 @@
+/* **************************************
+ * Module: ELF loader
+ *
+ * - Little-endian ELF32 RISC-V executables (e.g. riscv32-unknown-elf-gcc -march=rv32i -mabi=ilp32)
+ * - imem and dmem are separate: executable PT_LOAD segments are copied to
+ *   imem, every PT_LOAD segment is copied to dmem at the same address so
+ *   constants next to the code can still be loaded
+ * - The stack starts at the top of dmem with argc = 0 and argv = NULL
+ *   (what crt0 expects), the heap right after the highest segment
+ * - Code symbols of .symtab for the profiler, any symbol by name for the
+ *   front-ends (the signature bounds of a compliance test)
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+#include <string.h>
+
+#define EM_RISCV 243
+#define PT_LOAD 1
+#define PF_X 1
+
+static uint32_t rd16(const uint8_t* p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+static uint32_t rd32(const uint8_t* p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// copy a segment into a word memory, bytes past the file contents are zero
+static void load_segment(uint32_t* mem, uint32_t vaddr, const uint8_t* data, uint32_t filesz, uint32_t memsz)
+{
+	for (uint32_t i = 0; i < memsz; i++) {
+		uint32_t addr = vaddr + i;
+		uint32_t shift = (addr & 0x3) << 3;
+		uint32_t b = (i < filesz) ? data[i] : 0;
+		mem[addr >> 2] = (mem[addr >> 2] & ~(0xffu << shift)) | (b << shift);
+	}
+}
+
+// returns the file contents (free() it) or NULL
+static uint8_t* elf_read(const char* path, size_t* size)
+{
+	FILE* fp;
+	uint8_t* buf;
+	long n;
+
+	if ((fp = fopen(path, "rb")) == NULL) return NULL;
+	fseek(fp, 0, SEEK_END);
+	n = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	buf = (uint8_t*)malloc(n > 0 ? n : 1);
+	if (n < 0 || fread(buf, 1, n, fp) != (size_t)n) {
+		free(buf);
+		buf = NULL;
+	}
+	fclose(fp);
+	*size = n;
+	return buf;
+}
+
+static int elf_check(const uint8_t* elf, size_t size)
+{
+	if (size < 52 || memcmp(elf, "\177ELF", 4) != 0) return 0;
+	if (elf[4] != 1 || elf[5] != 1) return 0;	// ELFCLASS32, ELFDATA2LSB
+	return rd16(elf + 18) == EM_RISCV;
+}
+
+int rv32i_load_elf(rv32i_core* core, const char* path)
+{
+	size_t size;
+	uint8_t* elf = elf_read(path, &size);
+	int ret = 0;
+
+	if (!elf) return RV32I_ERR_OPEN;
+	if (!elf_check(elf, size)) {
+		free(elf);
+		return RV32I_ERR_FORMAT;
+	}
+
+	uint32_t phoff = rd32(elf + 28), phentsize = rd16(elf + 42), phnum = rd16(elf + 44);
+	uint32_t heap = 0;
+	if (phnum && (phentsize < 32 || (uint64_t)phoff + (uint64_t)phnum * phentsize > size)) ret = RV32I_ERR_FORMAT;	// the table, before any entry is read
+
+	memset(core->imem_data, 0, core->cfg.imem_depth * sizeof(uint32_t));
+	memset(core->dmem_image, 0, core->cfg.dmem_depth * sizeof(uint32_t));
+
+	for (uint32_t i = 0; i < phnum && ret == 0; i++) {
+		const uint8_t* ph = elf + phoff + (size_t)i * phentsize;
+		if (rd32(ph) == PT_LOAD) {
+			uint32_t offset = rd32(ph + 4), vaddr = rd32(ph + 8), filesz = rd32(ph + 16), memsz = rd32(ph + 20), flags = rd32(ph + 24);
+			if ((uint64_t)offset + filesz > size || filesz > memsz) ret = RV32I_ERR_FORMAT;
+			else if ((uint64_t)vaddr + memsz > (uint64_t)core->cfg.dmem_depth * 4 || ((flags & PF_X) && (uint64_t)vaddr + memsz > (uint64_t)core->cfg.imem_depth * 4)) ret = RV32I_ERR_RANGE;
+			else {
+				if (flags & PF_X) load_segment(core->imem_data, vaddr, elf + offset, filesz, memsz);
+				load_segment(core->dmem_image, vaddr, elf + offset, filesz, memsz);
+				if (vaddr + memsz > heap) heap = vaddr + memsz;
+			}
+		}
+	}
+
+	if (ret == 0) {
+		core->entry = rd32(elf + 24);
+		core->stack = (core->cfg.dmem_depth * 4 - 16) & ~0xfu;	// argc, argv[0] = 0
+		core->heap = (heap + 7) & ~0x7u;
+	}
+	free(elf);
+	rv32i_reset(core);
+	return ret;
+}
+
+// the SHT_SYMTAB sections with their string tables in turn: symtab_next() returns the entries of the next one, NULL after the last
+struct symtab {
+	const uint8_t* elf;
+	size_t size;
+	uint32_t section;	// next section to look at
+	uint32_t count;		// entries
+	const char* str;
+	uint32_t str_size;
+};
+
+static const uint8_t* symtab_next(struct symtab* t)
+{
+	const uint8_t* elf = t->elf;
+	uint32_t shoff = rd32(elf + 32), shentsize = rd16(elf + 46), shnum = rd16(elf + 48);
+	if (shentsize < 40 || (uint64_t)shoff + (uint64_t)shnum * shentsize > t->size) return NULL;
+
+	while (t->section < shnum) {
+		const uint8_t* sh = elf + shoff + (size_t)t->section++ * shentsize;
+		uint32_t link = rd32(sh + 24);	// its string table, a section inside the table checked above
+		if (rd32(sh + 4) != 2 || link >= shnum || (uint64_t)shoff + ((uint64_t)link + 1) * shentsize > t->size) continue;	// SHT_SYMTAB
+		const uint8_t* strtab = elf + shoff + (size_t)link * shentsize;
+		uint32_t off = rd32(sh + 16), count = rd32(sh + 20) / 16;
+		uint32_t str_off = rd32(strtab + 16), str_size = rd32(strtab + 20);
+		if ((uint64_t)off + count * 16 > t->size || (uint64_t)str_off + str_size > t->size) continue;
+		t->count = count;
+		t->str = (const char*)elf + str_off;
+		t->str_size = str_size;
+		return elf + off;
+	}
+	return NULL;
+}
+
+// the name of an entry, NULL if it has none inside the string table
+static const char* sym_name(const struct symtab* t, const uint8_t* st)
+{
+	uint32_t name = rd32(st);
+	if (name == 0 || name >= t->str_size || !memchr(t->str + name, '\0', t->str_size - name)) return NULL;
+	return t->str + name;
+}
+
+static int sym_cmp(const void* a, const void* b)
+{
+	const struct rv32i_sym* x = (const struct rv32i_sym*)a;
+	const struct rv32i_sym* y = (const struct rv32i_sym*)b;
+	if (x->addr != y->addr) return (x->addr < y->addr) ? -1 : 1;
+	return y->func - x->func;	// functions first among aliases
+}
+
+int rv32i_elf_symbols(const char* path, struct rv32i_sym** syms)
+{
+	size_t size;
+	uint8_t* elf = elf_read(path, &size);
+	int n = 0, k;
+
+	*syms = NULL;
+	if (!elf) return RV32I_ERR_OPEN;
+	if (!elf_check(elf, size)) {
+		free(elf);
+		return RV32I_ERR_FORMAT;
+	}
+
+	struct symtab t = { elf, size, 0, 0, NULL, 0 };
+	const uint8_t* tab;
+
+	while ((tab = symtab_next(&t)) != NULL) {
+		*syms = (struct rv32i_sym*)realloc(*syms, (n + t.count) * sizeof(struct rv32i_sym));
+		for (uint32_t j = 0; j < t.count; j++) {
+			const uint8_t* st = tab + j * 16;
+			uint32_t type = st[12] & 0xf, shndx = rd16(st + 14);
+			if (type > 2 || type == 1 || shndx == 0 || shndx >= 0xff00) continue;	// code labels
+			const char* s = sym_name(&t, st);
+			if (!s || s[0] == '$' || (s[0] == '.' && s[1] == 'L')) continue;	// mapping and local labels
+			(*syms)[n].addr = rd32(st + 4);
+			(*syms)[n].size = rd32(st + 8);
+			(*syms)[n].func = (type == 2);
+			(*syms)[n].name = strdup(s);
+			n++;
+		}
+	}
+	free(elf);
+
+	// one symbol per address, sizeless ones extend to the next symbol
+	qsort(*syms, n, sizeof(struct rv32i_sym), sym_cmp);
+	for (int i = k = 0; i < n; i++) {
+		if (k && (*syms)[k - 1].addr == (*syms)[i].addr) free((*syms)[i].name);
+		else (*syms)[k++] = (*syms)[i];
+	}
+	for (int i = 0; i < k; i++) {
+		if (!(*syms)[i].size) (*syms)[i].size = (i + 1 < k) ? (*syms)[i + 1].addr - (*syms)[i].addr : 0u - (*syms)[i].addr;
+	}
+	return k;
+}
+
+int rv32i_elf_symbol(const char* path, const char* name, uint32_t* value)
+{
+	size_t size;
+	uint8_t* elf = elf_read(path, &size);
+	int ret = RV32I_ERR_FORMAT;
+
+	if (!elf) return RV32I_ERR_OPEN;
+	if (elf_check(elf, size)) {
+		struct symtab t = { elf, size, 0, 0, NULL, 0 };
+		const uint8_t* tab;
+		while (ret < 0 && (tab = symtab_next(&t)) != NULL) {
+			for (uint32_t j = 0; j < t.count; j++) {
+				const char* s = sym_name(&t, tab + j * 16);
+				if (s && rd16(tab + j * 16 + 14) != 0 && !strcmp(s, name)) {	// defined
+					*value = rd32(tab + j * 16 + 4);
+					ret = 0;
+					break;
+				}
+			}
+		}
+	}
+	free(elf);
+	return ret;
+}
@@ -0,0 +1,643 @@
+/* **************************************
+ * Module: gdb remote stub
+ *
+ * - Serves one gdb (remote serial protocol) over loopback TCP ("[host]:port")
+ *   or a Unix socket (any other address, "target remote unix::path" in gdb)
+ * - Registers x0-x31 and pc, memory is dmem (which holds a copy of the
+ *   code of an ELF); a write also patches imem where imem holds the word
+ *   dmem held, so gdb's "load" and code patches reach the fetch
+ * - Breakpoints are ebreaks the stub writes into imem while the core runs,
+ *   so a run without breakpoints is the plain rv32i_step() loop; the
+ *   engines trap an ebreak once the older instructions are done, the
+ *   instructions behind it haven't changed anything, and the core restarts
+ *   from the ebreak's pc with the original word
+ * - Single-step, interrupt (^C) and watchpoints stop on the next instruction
+ *   fetched by making every other imem word an ebreak; a watchpoint stops
+ *   after the access (a few instructions later on the pipeline, the ones
+ *   already fetched complete), accesses are matched by word
+ * - With an undo log attached (rv32i_undo_create), reverse-step and
+ *   reverse-continue (bs/bc) run backwards to the previous instruction, the
+ *   last breakpoint or the last write to a write/access watchpoint's word,
+ *   "replaylog:begin" at the earliest cycle; a stop going forward also pops
+ *   the cycle of the trapping ebreak, so the cycles and instructions counted
+ *   are the program's own
+ * - Single-cycle and pipeline engines (the others don't trap ebreak)
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+#include <string.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#define EBREAK 0x00100073
+#define STEP_CYCLES 64	// enough for one instruction to leave the pipeline
+
+enum { POINT_SW = 0, POINT_HW, POINT_WRITE, POINT_READ, POINT_ACCESS };	// Z packet types
+
+struct gdb_point {
+	uint32_t addr;
+	uint32_t len;
+	uint8_t type;
+};
+
+struct rv32i_gdb {
+	rv32i_core* core;
+	int listen_fd;
+	int fd;					// connection, -1 when gdb is gone
+	char* unix_path;		// unlinked on destroy
+	int no_ack;
+
+	uint32_t* code;			// imem without the stub's ebreaks
+	struct gdb_point bp[GDB_POINT_NUM];
+	int bps;
+	struct gdb_point wp[GDB_POINT_NUM];
+	int wps;
+	int stop_all;			// every imem word is an ebreak
+	rv32i_mem_cb mem_cb;	// the callback the watchpoints chain to
+	void* mem_arg;
+	const struct gdb_point* hit;	// watchpoint hit while running
+
+	char stop[32];			// reply to '?'
+	char xml[2048];			// target description
+	char rx[GDB_PACKET_MAX];
+	int rx_len, rx_pos;
+	char pkt[GDB_PACKET_MAX];
+	char out[GDB_PACKET_MAX];
+	char tx[GDB_PACKET_MAX];
+};
+
+static const char* const reg_name[32] = {
+	"zero", "ra", "sp", "gp", "tp", "t0", "t1", "t2", "fp", "s1", "a0", "a1", "a2", "a3", "a4", "a5",
+	"a6", "a7", "s2", "s3", "s4", "s5", "s6", "s7", "s8", "s9", "s10", "s11", "t3", "t4", "t5", "t6"
+};
+
+static const char hex_digit[] = "0123456789abcdef";
+
+static int hex_val(char c)
+{
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+// a register as gdb sends it: 8 hex digits, least significant byte first
+static char* put_reg(char* p, uint32_t v)
+{
+	for (int i = 0; i < 4; i++, v >>= 8) {
+		*p++ = hex_digit[v >> 4 & 0xf];
+		*p++ = hex_digit[v & 0xf];
+	}
+	*p = 0;
+	return p;
+}
+
+static int get_reg(const char* p, uint32_t* v)
+{
+	*v = 0;
+	for (int i = 0; i < 4; i++) {
+		int hi = hex_val(p[2 * i]), lo = hex_val(p[2 * i + 1]);
+		if (hi < 0 || lo < 0) return -1;
+		*v |= (uint32_t)(hi << 4 | lo) << (8 * i);
+	}
+	return 0;
+}
+
+static int readable(int fd)
+{
+	struct pollfd pfd = { fd, POLLIN, 0 };
+	return poll(&pfd, 1, 0) > 0;
+}
+
+// a byte from gdb, -1 once the connection is closed
+static int rx_byte(rv32i_gdb* gdb)
+{
+	if (gdb->rx_pos == gdb->rx_len) {
+		ssize_t n;
+		if (gdb->fd < 0) return -1;
+		while ((n = recv(gdb->fd, gdb->rx, sizeof(gdb->rx), 0)) < 0 && errno == EINTR);
+		if (n <= 0) {
+			close(gdb->fd);
+			gdb->fd = -1;
+			return -1;
+		}
+		gdb->rx_len = (int)n;
+		gdb->rx_pos = 0;
+	}
+	return (uint8_t)gdb->rx[gdb->rx_pos++];
+}
+
+static void tx(rv32i_gdb* gdb, const char* buf, size_t len)
+{
+	while (len && gdb->fd >= 0) {
+		ssize_t n = send(gdb->fd, buf, len, MSG_NOSIGNAL);
+		if (n < 0 && errno == EINTR) continue;
+		if (n <= 0) {
+			close(gdb->fd);
+			gdb->fd = -1;
+			return;
+		}
+		buf += n;
+		len -= n;
+	}
+}
+
+// the next packet into gdb->pkt, 0 at the end of the connection
+static int get_packet(rv32i_gdb* gdb)
+{
+	int c;
+	for (;;) {
+		while ((c = rx_byte(gdb)) != '$') {
+			if (c < 0) return 0;
+		}
+		int len = 0;
+		uint8_t sum = 0;
+		while ((c = rx_byte(gdb)) != '#' && c >= 0) {
+			sum += c;
+			if (len < GDB_PACKET_MAX - 1) gdb->pkt[len++] = c;
+		}
+		int hi = hex_val(rx_byte(gdb)), lo = hex_val(rx_byte(gdb));
+		if (c < 0 || hi < 0 || lo < 0) return 0;
+		gdb->pkt[len] = 0;
+		if (gdb->no_ack) return 1;
+		if ((hi << 4 | lo) == sum) {
+			tx(gdb, "+", 1);
+			return 1;
+		}
+		tx(gdb, "-", 1);
+	}
+}
+
+static void put_packet(rv32i_gdb* gdb, const char* data)
+{
+	size_t len = strlen(data);
+	uint8_t sum = 0;
+
+	if (len > GDB_PACKET_MAX - 4) len = GDB_PACKET_MAX - 4;
+	gdb->tx[0] = '$';
+	for (size_t i = 0; i < len; i++) sum += (uint8_t)(gdb->tx[i + 1] = data[i]);
+	gdb->tx[len + 1] = '#';
+	gdb->tx[len + 2] = hex_digit[sum >> 4];
+	gdb->tx[len + 3] = hex_digit[sum & 0xf];
+	tx(gdb, gdb->tx, len + 4);
+	// the acknowledgement, a retransmission request is answered once more
+	if (!gdb->no_ack && rx_byte(gdb) == '-') {
+		tx(gdb, gdb->tx, len + 4);
+		rx_byte(gdb);
+	}
+}
+
+// planting: the stub's ebreaks are in imem only while the core runs
+static void plant(rv32i_gdb* gdb)
+{
+	uint32_t* imem = gdb->core->imem_data;
+	for (int i = 0; i < gdb->bps; i++) {
+		if ((gdb->bp[i].addr >> 2) < gdb->core->cfg.imem_depth) imem[gdb->bp[i].addr >> 2] = EBREAK;
+	}
+}
+
+static void plant_all(rv32i_gdb* gdb, uint32_t except)
+{
+	uint32_t* imem = gdb->core->imem_data;
+	for (uint32_t i = 0; i < gdb->core->cfg.imem_depth; i++) imem[i] = EBREAK;
+	if ((except >> 2) < gdb->core->cfg.imem_depth) imem[except >> 2] = gdb->code[except >> 2];
+	gdb->stop_all = 1;
+}
+
+static void unplant(rv32i_gdb* gdb)
+{
+	uint32_t* imem = gdb->core->imem_data;
+	if (gdb->stop_all) memcpy(imem, gdb->code, gdb->core->cfg.imem_depth * sizeof(uint32_t));
+	else {
+		for (int i = 0; i < gdb->bps; i++) {
+			if ((gdb->bp[i].addr >> 2) < gdb->core->cfg.imem_depth) imem[gdb->bp[i].addr >> 2] = gdb->code[gdb->bp[i].addr >> 2];
+		}
+	}
+	gdb->stop_all = 0;
+}
+
+static void watch(void* arg, const struct rv32i_mem_access* access)
+{
+	rv32i_gdb* gdb = (rv32i_gdb*)arg;
+	uint32_t word = access->addr & ~3u;
+
+	for (int i = 0; i < gdb->wps && !gdb->hit; i++) {
+		const struct gdb_point* wp = &gdb->wp[i];
+		if (word >= wp->addr + wp->len || word + 4 <= wp->addr) continue;
+		if (wp->type == POINT_ACCESS || (wp->type == POINT_WRITE) == (access->write != 0)) {
+			gdb->hit = wp;
+			if (!gdb->stop_all) plant_all(gdb, ~0u);
+		}
+	}
+	if (gdb->mem_cb) gdb->mem_cb(gdb->mem_arg, access);
+}
+
+// runs the core until it stops, sets the stop reply, returns 0 if gdb went away
+static int resume(rv32i_gdb* gdb, int step)
+{
+	rv32i_core* core = gdb->core;
+	uint32_t pc = rv32i_get_pc(core);
+	uint64_t quiet = 0;	// cycles run since every word became an ebreak
+
+	gdb->hit = NULL;
+	if (core->halted) {	// the program exited, nothing to run
+		snprintf(gdb->stop, sizeof(gdb->stop), "W%02x", core->reg_data[10] & 0xff);
+		return 1;
+	}
+	if (step) plant_all(gdb, pc);
+	else plant(gdb);
+
+	while (!core->halted) {
+		if (gdb->stop_all) {
+			// nothing traps: the instruction jumps to itself (step), or the pc left imem
+			if (quiet == STEP_CYCLES) plant_all(gdb, ~0u);
+			else if (quiet == 2 * STEP_CYCLES) break;
+			quiet += rv32i_step(core, STEP_CYCLES);
+			continue;
+		}
+		rv32i_step(core, GDB_CHUNK);
+		if (!core->halted && readable(gdb->fd)) {
+			int c = rx_byte(gdb);
+			if (c < 0) break;
+			if (c == 0x03) plant_all(gdb, ~0u);	// ^C
+		}
+	}
+	unplant(gdb);
+
+	if (core->halted && !core->ebreak) {	// exit(a0) of the syscall proxy
+		snprintf(gdb->stop, sizeof(gdb->stop), "W%02x", core->reg_data[10] & 0xff);
+		return gdb->fd >= 0;
+	}
+	if (core->ebreak && core->undo) rv32i_undo_goto(core->undo, core->cycle - 1);
+	else rv32i_core_restart(core, core->ebreak ? core->ebreak_pc : rv32i_get_pc(core));
+	if (gdb->hit) {
+		static const char* const kind[] = { "", "", "watch", "rwatch", "awatch" };
+		snprintf(gdb->stop, sizeof(gdb->stop), "T05%s:%08x;", kind[gdb->hit->type], gdb->hit->addr);
+	}
+	else snprintf(gdb->stop, sizeof(gdb->stop), "S05");
+	return gdb->fd >= 0;
+}
+
+// bs/bc: runs the core backwards (rv32i_undo), sets the stop reply
+static void reverse(rv32i_gdb* gdb, int step)
+{
+	rv32i_core* core = gdb->core;
+	struct rv32i_undo_stop stop[2 * GDB_POINT_NUM];
+	const struct gdb_point* point[2 * GDB_POINT_NUM];
+	uint64_t first = rv32i_undo_first(core->undo);
+	int n = 0, hit = -1;
+
+	// replays from a checkpoint run the program again, which mustn't trip the watchpoints
+	int watching = (core->mem_cb == watch);
+	if (watching) rv32i_set_mem_cb(core, gdb->mem_cb, gdb->mem_arg);
+	if (step) {
+		if (core->cycle > first) {
+			rv32i_undo_goto(core->undo, core->cycle - 1);
+			hit = 0;
+		}
+	}
+	else {
+		for (int i = 0; i < gdb->bps; i++) {
+			stop[n] = (struct rv32i_undo_stop){ gdb->bp[i].addr, 1, 0 };
+			point[n++] = &gdb->bp[i];
+		}
+		for (int i = 0; i < gdb->wps; i++) {
+			if (gdb->wp[i].type == POINT_READ) continue;	// reads aren't logged
+			stop[n] = (struct rv32i_undo_stop){ gdb->wp[i].addr, gdb->wp[i].len, 1 };
+			point[n++] = &gdb->wp[i];
+		}
+		hit = rv32i_undo_reverse(core->undo, stop, n);
+	}
+	if (watching) rv32i_set_mem_cb(core, watch, gdb);
+
+	if (hit < 0) snprintf(gdb->stop, sizeof(gdb->stop), "T05replaylog:begin;");
+	else if (!step && point[hit]->type != POINT_SW) {
+		snprintf(gdb->stop, sizeof(gdb->stop), "T05%s:%08x;", point[hit]->type == POINT_WRITE ? "watch" : "awatch", point[hit]->addr);
+	}
+	else snprintf(gdb->stop, sizeof(gdb->stop), "S05");
+}
+
+// a dmem byte, -1 outside dmem
+static int mem_rd8(rv32i_core* core, uint32_t addr)
+{
+	if ((addr >> 2) >= core->cfg.dmem_depth) return -1;
+	return core->dmem_data[addr >> 2] >> ((addr & 0x3) << 3) & 0xff;
+}
+
+static int mem_wr8(rv32i_gdb* gdb, uint32_t addr, uint8_t b)
+{
+	rv32i_core* core = gdb->core;
+	uint32_t idx = addr >> 2, shift = (addr & 0x3) << 3;
+	if (idx >= core->cfg.dmem_depth) return -1;
+
+	uint32_t old = core->dmem_data[idx];
+	uint32_t new = (old & ~(0xffu << shift)) | ((uint32_t)b << shift);
+	if (core->undo) {
+		rv32i_undo_mem(core->undo, idx);
+		rv32i_undo_edit(core->undo);
+	}
+	core->dmem_data[idx] = new;
+	if (idx < core->cfg.imem_depth && gdb->code[idx] == old) gdb->code[idx] = core->imem_data[idx] = new;
+	return 0;
+}
+
+static int set_point(rv32i_gdb* gdb, int insert, int type, uint32_t addr, uint32_t len)
+{
+	struct gdb_point* list = (type <= POINT_HW) ? gdb->bp : gdb->wp;
+	int* count = (type <= POINT_HW) ? &gdb->bps : &gdb->wps;
+	int i;
+
+	if (type > POINT_ACCESS) return 1;	// unsupported: empty reply
+	if (type <= POINT_HW) type = POINT_SW;
+	for (i = 0; i < *count; i++) {
+		if (list[i].addr == addr && list[i].len == len && list[i].type == type) break;
+	}
+	if (insert && i == *count) {
+		if (*count == GDB_POINT_NUM) return -1;
+		list[(*count)++] = (struct gdb_point){ addr, len ? len : 1, (uint8_t)type };
+	}
+	else if (!insert && i < *count) list[i] = list[--(*count)];
+
+	// the memory callback is only there while a watchpoint is
+	if (type != POINT_SW) {
+		rv32i_core* core = gdb->core;
+		if (gdb->wps && core->mem_cb != watch) {
+			gdb->mem_cb = core->mem_cb;
+			gdb->mem_arg = core->mem_arg;
+			rv32i_set_mem_cb(core, watch, gdb);
+		}
+		else if (!gdb->wps && core->mem_cb == watch) rv32i_set_mem_cb(core, gdb->mem_cb, gdb->mem_arg);
+	}
+	return 0;
+}
+
+static void read_regs(rv32i_gdb* gdb)
+{
+	char* p = gdb->out;
+	for (int i = 0; i < 32; i++) p = put_reg(p, rv32i_get_reg(gdb->core, i));
+	put_reg(p, rv32i_get_pc(gdb->core));
+}
+
+static int write_reg(rv32i_gdb* gdb, int reg, uint32_t v)
+{
+	if (reg == 32) rv32i_core_restart(gdb->core, v);
+	else if (reg >= 0 && reg < 32) rv32i_set_reg(gdb->core, reg, v);
+	else return -1;
+	return 0;
+}
+
+// qXfer:features:read:target.xml:offset,length
+static void read_xml(rv32i_gdb* gdb, const char* args)
+{
+	unsigned long off, len;
+	size_t size = strlen(gdb->xml);
+
+	if (strncmp(args, "target.xml:", 11) || sscanf(args + 11, "%lx,%lx", &off, &len) != 2) {
+		strcpy(gdb->out, "E00");
+		return;
+	}
+	if (off > size) off = size;
+	if (len > sizeof(gdb->out) - 2) len = sizeof(gdb->out) - 2;
+	if (len > size - off) len = size - off;
+	gdb->out[0] = (off + len < size) ? 'm' : 'l';
+	memcpy(gdb->out + 1, gdb->xml + off, len);
+	gdb->out[len + 1] = 0;
+}
+
+// answers one packet, 0 ends the session
+static int handle(rv32i_gdb* gdb)
+{
+	rv32i_core* core = gdb->core;
+	char* pkt = gdb->pkt;
+	char* out = gdb->out;
+	unsigned long addr, len, type;
+	uint32_t v;
+	int reg;
+
+	out[0] = 0;
+	switch (pkt[0]) {
+	case '?':
+		strcpy(out, gdb->stop);
+		break;
+	case 'g':
+		read_regs(gdb);
+		break;
+	case 'G':
+		for (reg = 0; reg <= 32 && strlen(pkt + 1) >= (size_t)8 * (reg + 1); reg++) {
+			if (get_reg(pkt + 1 + 8 * reg, &v) == 0) write_reg(gdb, reg, v);
+		}
+		strcpy(out, "OK");
+		break;
+	case 'p':
+		reg = (int)strtol(pkt + 1, NULL, 16);
+		if (reg == 32) put_reg(out, rv32i_get_pc(core));
+		else if (reg >= 0 && reg < 32) put_reg(out, rv32i_get_reg(core, reg));
+		else strcpy(out, "E01");
+		break;
+	case 'P': {
+		char* eq = strchr(pkt, '=');
+		reg = (int)strtol(pkt + 1, NULL, 16);
+		strcpy(out, (eq && get_reg(eq + 1, &v) == 0 && write_reg(gdb, reg, v) == 0) ? "OK" : "E01");
+		break;
+	}
+	case 'm': {
+		if (sscanf(pkt + 1, "%lx,%lx", &addr, &len) != 2) {
+			strcpy(out, "E01");
+			break;
+		}
+		char* p = out;
+		for (unsigned long i = 0; i < len && i < (GDB_PACKET_MAX - 1) / 2; i++) {
+			int b = mem_rd8(core, (uint32_t)(addr + i));
+			if (b < 0) break;
+			*p++ = hex_digit[b >> 4];
+			*p++ = hex_digit[b & 0xf];
+		}
+		*p = 0;
+		if (p == out && len) strcpy(out, "E01");
+		break;
+	}
+	case 'M': {
+		char* colon = strchr(pkt, ':');
+		if (!colon || sscanf(pkt + 1, "%lx,%lx", &addr, &len) != 2 || strlen(colon + 1) < 2 * len) {
+			strcpy(out, "E01");
+			break;
+		}
+		strcpy(out, "OK");
+		for (unsigned long i = 0; i < len; i++) {
+			int hi = hex_val(colon[1 + 2 * i]), lo = hex_val(colon[2 + 2 * i]);
+			if (hi < 0 || lo < 0 || mem_wr8(gdb, (uint32_t)(addr + i), (uint8_t)(hi << 4 | lo)) < 0) {
+				strcpy(out, "E01");
+				break;
+			}
+		}
+		break;
+	}
+	case 'c':
+	case 's':
+		if (pkt[1]) rv32i_core_restart(core, (uint32_t)strtoul(pkt + 1, NULL, 16));
+		if (!resume(gdb, pkt[0] == 's')) return 0;
+		strcpy(out, gdb->stop);
+		break;
+	case 'b':
+		if (!core->undo || (pkt[1] != 's' && pkt[1] != 'c')) break;
+		reverse(gdb, pkt[1] == 's');
+		strcpy(out, gdb->stop);
+		break;
+	case 'Z':
+	case 'z':
+		if (sscanf(pkt + 1, "%lx,%lx,%lx", &type, &addr, &len) != 3) {
+			strcpy(out, "E01");
+			break;
+		}
+		reg = set_point(gdb, pkt[0] == 'Z', (int)type, (uint32_t)addr, (uint32_t)len);
+		if (reg == 0) strcpy(out, "OK");
+		else if (reg < 0) strcpy(out, "E01");
+		break;
+	case 'H':
+		strcpy(out, "OK");
+		break;
+	case 'k':
+		return 0;
+	case 'D':
+		put_packet(gdb, "OK");
+		return 0;
+	case 'q':
+		if (!strncmp(pkt, "qSupported", 10)) {
+			snprintf(out, GDB_PACKET_MAX, "PacketSize=%x;qXfer:features:read+;QStartNoAckMode+%s", GDB_PACKET_MAX - 8,
+				core->undo ? ";ReverseStep+;ReverseContinue+" : "");
+		}
+		else if (!strncmp(pkt, "qXfer:features:read:", 20)) read_xml(gdb, pkt + 20);
+		else if (!strcmp(pkt, "qAttached")) strcpy(out, "1");
+		else if (!strcmp(pkt, "qC")) strcpy(out, "QC1");
+		else if (!strcmp(pkt, "qfThreadInfo")) strcpy(out, "m1");
+		else if (!strcmp(pkt, "qsThreadInfo")) strcpy(out, "l");
+		break;
+	case 'Q':
+		if (!strcmp(pkt, "QStartNoAckMode")) {
+			put_packet(gdb, "OK");
+			gdb->no_ack = 1;
+			return 1;
+		}
+		break;
+	case 'T':
+		strcpy(out, "OK");
+		break;
+	default:	// unsupported: empty reply (vCont, X, ...)
+		break;
+	}
+	put_packet(gdb, out);
+	return gdb->fd >= 0;
+}
+
+static int listen_on(rv32i_gdb* gdb, const char* address)
+{
+	const char* colon = strrchr(address, ':');
+	int fd, one = 1;
+
+	if (colon) {	// [host]:port, loopback unless a host is given
+		struct sockaddr_in sa = { 0 };
+		char host[64];
+		size_t n = colon - address;
+		sa.sin_family = AF_INET;
+		sa.sin_port = htons((uint16_t)atoi(colon + 1));
+		sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		if (n && n < sizeof(host) && strncmp(address, "localhost", n)) {
+			memcpy(host, address, n);
+			host[n] = 0;
+			if (inet_pton(AF_INET, host, &sa.sin_addr) != 1) return -1;
+		}
+		if ((fd = socket(AF_INET, SOCK_STREAM, 0)) < 0) return -1;
+		setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+		if (bind(fd, (struct sockaddr*)&sa, sizeof(sa)) < 0 || listen(fd, 1) < 0) {
+			close(fd);
+			return -1;
+		}
+	}
+	else {
+		struct sockaddr_un sa = { 0 };
+		if (strlen(address) >= sizeof(sa.sun_path)) return -1;
+		sa.sun_family = AF_UNIX;
+		strcpy(sa.sun_path, address);
+		if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) return -1;
+		unlink(address);
+		if (bind(fd, (struct sockaddr*)&sa, sizeof(sa)) < 0 || listen(fd, 1) < 0) {
+			close(fd);
+			return -1;
+		}
+		gdb->unix_path = strdup(address);
+	}
+	gdb->listen_fd = fd;
+	return 0;
+}
+
+rv32i_gdb* rv32i_gdb_create(rv32i_core* core, const char* address)
+{
+	if (core->engine != RV32I_SINGLE && core->engine != RV32I_PIPELINE) return NULL;
+
+	rv32i_gdb* gdb = (rv32i_gdb*)calloc(1, sizeof(rv32i_gdb));
+	gdb->core = core;
+	gdb->fd = -1;
+	if (listen_on(gdb, address) < 0) {
+		free(gdb);
+		return NULL;
+	}
+
+	int n = snprintf(gdb->xml, sizeof(gdb->xml), "<?xml version=\"1.0\"?><!DOCTYPE target SYSTEM \"gdb-target.dtd\">"
+		"<target version=\"1.0\"><architecture>riscv:rv32</architecture><feature name=\"org.gnu.gdb.riscv.cpu\">");
+	for (int i = 0; i < 32; i++) {
+		n += snprintf(gdb->xml + n, sizeof(gdb->xml) - n, "<reg name=\"%s\" bitsize=\"32\" type=\"%s\" regnum=\"%d\"/>",
+			reg_name[i], (i == 1) ? "code_ptr" : (i == 2 || i == 8) ? "data_ptr" : "int", i);
+	}
+	snprintf(gdb->xml + n, sizeof(gdb->xml) - n, "<reg name=\"pc\" bitsize=\"32\" type=\"code_ptr\" regnum=\"32\"/></feature></target>");
+	return gdb;
+}
+
+int rv32i_gdb_serve(rv32i_gdb* gdb)
+{
+	rv32i_core* core = gdb->core;
+	int one = 1;
+
+	while ((gdb->fd = accept(gdb->listen_fd, NULL, NULL)) < 0) {
+		if (errno != EINTR) return -1;
+	}
+	setsockopt(gdb->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));	// fails harmlessly on a Unix socket
+
+	gdb->code = (uint32_t*)malloc(core->cfg.imem_depth * sizeof(uint32_t));
+	memcpy(gdb->code, core->imem_data, core->cfg.imem_depth * sizeof(uint32_t));
+	gdb->no_ack = 0;
+	gdb->rx_len = gdb->rx_pos = 0;
+	snprintf(gdb->stop, sizeof(gdb->stop), "S05");
+
+	while (get_packet(gdb) && handle(gdb));
+
+	// leave the core as it was found: no watchpoint callback, no breakpoints
+	gdb->bps = 0;
+	if (core->mem_cb == watch) rv32i_set_mem_cb(core, gdb->mem_cb, gdb->mem_arg);
+	gdb->wps = 0;
+	free(gdb->code);
+	gdb->code = NULL;
+	if (gdb->fd >= 0) close(gdb->fd);
+	gdb->fd = -1;
+	return 0;
+}
+
+void rv32i_gdb_destroy(rv32i_gdb* gdb)
+{
+	if (!gdb) return;
+	close(gdb->listen_fd);
+	if (gdb->unix_path) {
+		unlink(gdb->unix_path);
+		free(gdb->unix_path);
+	}
+	free(gdb);
+}
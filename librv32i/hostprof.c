@@ -0,0 +1,78 @@
+/* **************************************
+ * Module: host time of the engines
+ *
+ * - Built with -DHOST_PROF (make -C librv32i CFLAGS="-O2 -fPIC -DHOST_PROF"),
+ *   otherwise the marks compile to nothing and the report is empty
+ * - The single-cycle and pipeline engines mark the stage they enter, the
+ *   ticks since the previous mark go to the stage left; rdtsc on x86,
+ *   clock_gettime elsewhere
+ * - Ticks are converted to nanoseconds with the clock_gettime time of the
+ *   rv32i_step/rv32i_run_until calls, so nothing but the counter is read
+ *   per stage
+ * - A mark costs a counter read, which the stages carry: compare
+ *   configurations against each other, not against an uninstrumented build
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+#include <time.h>
+
+#ifdef HOST_PROF
+static const char* const part_name[HOST_PART_NUM] = { "other", "fetch", "decode", "execute", "memory", "writeback", "hazard", "io" };
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+#if !defined(__x86_64__) && !defined(__i386__)
+uint64_t rv32i_host_now(void)
+{
+	return now_ns();
+}
+#endif
+
+void rv32i_host_start(rv32i_core* core)
+{
+	core->host_start_ns = now_ns();
+	core->host_part = HOST_OTHER;
+	core->host_last = rv32i_host_now();
+	core->host_on = 1;
+}
+
+void rv32i_host_stop(rv32i_core* core)
+{
+	rv32i_host_mark(core, HOST_OTHER);
+	core->host_on = 0;
+	core->host_ns += now_ns() - core->host_start_ns;
+}
+#endif
+
+int rv32i_host_report(rv32i_core* core, FILE* fp)
+{
+#ifdef HOST_PROF
+	uint64_t ticks = 0;
+	for (int i = 0; i < HOST_PART_NUM; i++) ticks += core->host_ticks[i];
+	if (!ticks || !core->cycle) return 0;
+
+	double ns_per_tick = (double)core->host_ns / ticks;
+	fputs("\nHOST TIME PER SIMULATED CYCLE\n", fp);
+	for (int i = 1; i <= HOST_PART_NUM; i++) {
+		int part = i % HOST_PART_NUM;	// other last
+		fprintf(fp, "%-10s: %8.2f ns  %5.1f%%\n", part_name[part], core->host_ticks[part] * ns_per_tick / core->cycle,
+			100.0 * core->host_ticks[part] / ticks);
+	}
+	fprintf(fp, "total     : %8.2f ns  (%llu cycles in %.3f ms, %.2f MHz)\n", (double)core->host_ns / core->cycle,
+		(unsigned long long)core->cycle, core->host_ns * 1e-6, core->host_ns ? 1e3 * core->cycle / core->host_ns : 0.0);
+	return 1;
+#else
+	(void)core;
+	(void)fp;
+	return 0;
+#endif
+}
@@ -0,0 +1,219 @@
+/* **************************************
+ * Module: librv32i public interface
+ *
+ * - Opaque core handle wrapping one of the C models (engines)
+ * - Runtime configuration (rv32i_config_*), loadable from a file
+ * - Load, reset, step and run the core in-process
+ * - Register/memory accessors and commit/memory callbacks
+ * - Multi-hart systems sharing one memory (rv32i_smp_*)
+ * - ELF loading and a newlib syscall proxy (rv32i_sys_*)
+ * - Guest profiler (rv32i_prof_*)
+ * - Pipeline viewer log (rv32i_view_*)
+ * - gdb remote stub (rv32i_gdb_*)
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#ifndef _LIBRV32I_H_
+#define _LIBRV32I_H_
+
+#include <stdio.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct rv32i_core rv32i_core;
+typedef struct rv32i_smp rv32i_smp;
+typedef struct rv32i_prof rv32i_prof;
+typedef struct rv32i_view rv32i_view;
+typedef struct rv32i_gdb rv32i_gdb;
+typedef struct rv32i_undo rv32i_undo;
+
+enum rv32i_engine {
+	RV32I_SINGLE = 0,	// single-cycle model
+	RV32I_PIPELINE,		// 5-stage pipeline, mirrors pipeline_cpu.sv
+	RV32I_DUAL,			// dual-issue in-order pipeline
+	RV32I_OOO,			// out-of-order timing model
+	RV32I_ENGINE_NUM
+};
+
+enum rv32i_mem {
+	RV32I_IMEM = 0,
+	RV32I_DMEM
+};
+
+// error codes of the loaders
+#define RV32I_ERR_OPEN		-1	// file can't be opened
+#define RV32I_ERR_FORMAT	-2	// incomplete instruction word, not a little-endian RV32 ELF
+#define RV32I_ERR_RANGE		-3	// ELF segment outside imem/dmem
+
+// a retired instruction (all-zero words are not reported)
+struct rv32i_commit {
+	uint64_t cycle;
+	uint32_t pc;
+	uint32_t inst;
+	uint8_t rd;
+	uint8_t reg_write;
+	uint32_t rd_din;
+};
+
+// a dmem access, reported when it reaches the memory
+struct rv32i_mem_access {
+	uint64_t cycle;
+	uint32_t pc;
+	uint32_t addr;		// byte address
+	uint32_t data;		// word written, or word read
+	uint8_t write;
+};
+
+// runtime configuration of a core, fixed at creation
+enum rv32i_stage {
+	RV32I_STAGE_IF = 0,
+	RV32I_STAGE_ID,
+	RV32I_STAGE_EX,
+	RV32I_STAGE_MEM,
+	RV32I_STAGE_WB
+};
+
+struct rv32i_config {
+	enum rv32i_engine engine;
+	uint32_t imem_depth;	// words
+	uint32_t dmem_depth;	// words
+	uint64_t max_cycles;	// run length for the front-ends, the library doesn't enforce it
+	uint8_t byte_lanes;		// single and pipeline engines: sb/sh write only their bytes and accesses may be misaligned,
+							// otherwise dmem is word-granular like the RTL (rv32i_create_config fails for the others)
+	uint16_t vlen;			// single engine: bits of the Zve32x vector registers, 128 or 256,
+							// 0 without the vector unit (its instructions are nops)
+	// pipeline engine
+	uint8_t forwarding;		// forward MEM and WB results to EX, otherwise ID waits until the producer reaches WB
+	uint8_t flush_opt;		// a taken branch doesn't flush the instructions already fetched from its target
+	uint8_t branch_stage;	// RV32I_STAGE_ID, _EX or _MEM: where branches and jumps are resolved
+	uint8_t fusion;			// adjacent lui+addi, auipc+jalr/lw/sw and slli+srli pairs take one pipeline slot
+};
+
+// statistics of the single-cycle and pipeline engines since reset
+struct rv32i_stats {
+	uint64_t cycles;
+	uint64_t retired;
+	uint64_t stall;			// bubbles of load-use, RAW and ecall stalls
+	uint64_t flush;			// bubbles of flushed instructions
+	uint64_t idle;			// bubbles nothing caused (pipeline fill, running past the program)
+	uint64_t fused;			// instruction pairs retired as one (counted in retired twice)
+};
+
+typedef void (*rv32i_commit_cb)(void* arg, const struct rv32i_commit* commit);
+typedef void (*rv32i_mem_cb)(void* arg, const struct rv32i_mem_access* access);
+typedef int (*rv32i_pred)(rv32i_core* core, void* arg);
+typedef void (*rv32i_ecall_cb)(void* arg, rv32i_core* core, uint32_t pc);	// a7 holds the call number
+
+// configuration: "key = value" lines, '#' starts a comment
+// keys: engine, imem_depth, dmem_depth, max_cycles, byte_lanes, vlen, forwarding, flush_opt, branch_stage (ID, EX or MEM), fusion
+void rv32i_config_init(struct rv32i_config* cfg, enum rv32i_engine engine);	// defaults: the sizes and behaviour of the RTL
+int rv32i_config_set(struct rv32i_config* cfg, const char* key, const char* value);	// returns 0 or RV32I_ERR_FORMAT
+int rv32i_config_load(struct rv32i_config* cfg, const char* file);	// returns 0, or RV32I_ERR_* of the first bad line
+void rv32i_config_write(const struct rv32i_config* cfg, FILE* fp);
+
+// lifetime
+rv32i_core* rv32i_create(enum rv32i_engine engine);	// default configuration
+rv32i_core* rv32i_create_config(const struct rv32i_config* cfg);
+const struct rv32i_config* rv32i_get_config(rv32i_core* core);
+void rv32i_destroy(rv32i_core* core);
+const char* rv32i_engine_name(enum rv32i_engine engine);
+
+// loading: the loaded contents become the image restored by rv32i_reset(), the core is reset
+int rv32i_load_image(rv32i_core* core, const char* imem_file, const char* dmem_file);
+int rv32i_load_file(rv32i_core* core, enum rv32i_mem mem, const char* path);	// returns words read or RV32I_ERR_*
+void rv32i_load_words(rv32i_core* core, enum rv32i_mem mem, const uint32_t* words, uint32_t count);
+int rv32i_load_elf(rv32i_core* core, const char* path);	// returns 0 or RV32I_ERR_*, see elf.c for the memory layout
+int rv32i_elf_symbol(const char* path, const char* name, uint32_t* value);	// returns 0 or RV32I_ERR_* (RV32I_ERR_FORMAT: not defined)
+
+// execution
+void rv32i_reset(rv32i_core* core);
+uint64_t rv32i_step(rv32i_core* core, uint64_t cycles);
+uint64_t rv32i_run_until(rv32i_core* core, rv32i_pred pred, void* arg, uint64_t max_cycles);
+void rv32i_halt(rv32i_core* core);	// stop stepping until the next reset (exit, ebreak)
+int rv32i_halted(rv32i_core* core);
+
+// state accessors (memory addresses are byte addresses of aligned words)
+uint32_t rv32i_get_pc(rv32i_core* core);
+uint32_t rv32i_get_reg(rv32i_core* core, int reg);
+void rv32i_set_reg(rv32i_core* core, int reg, uint32_t value);
+uint32_t rv32i_read_mem(rv32i_core* core, enum rv32i_mem mem, uint32_t addr);
+void rv32i_write_mem(rv32i_core* core, enum rv32i_mem mem, uint32_t addr, uint32_t value);
+uint64_t rv32i_get_cycles(rv32i_core* core);
+uint64_t rv32i_get_retired(rv32i_core* core);
+void rv32i_get_stats(rv32i_core* core, struct rv32i_stats* stats);
+
+// observation
+void rv32i_set_commit_cb(rv32i_core* core, rv32i_commit_cb cb, void* arg);
+void rv32i_set_mem_cb(rv32i_core* core, rv32i_mem_cb cb, void* arg);
+void rv32i_set_ecall_cb(rv32i_core* core, rv32i_ecall_cb cb, void* arg);	// ecall is a nop without one, ebreak halts
+void rv32i_set_trace(rv32i_core* core, FILE* fp);	// per-cycle debug output of the engine, NULL to disable
+void rv32i_show_state(rv32i_core* core);
+int rv32i_report(rv32i_core* core, FILE* fp);	// engine statistics, nonzero if the engine found an error
+int rv32i_host_report(rv32i_core* core, FILE* fp);	// host ns per simulated cycle by stage, librv32i built with -DHOST_PROF (0: nothing printed)
+
+// multi-hart system: single-cycle harts sharing imem and dmem, one host thread per hart
+// hart n starts with x10 (a0) = n and halts on a jump to itself or when its pc leaves imem
+rv32i_smp* rv32i_smp_create(int harts);
+void rv32i_smp_destroy(rv32i_smp* smp);
+int rv32i_smp_load_image(rv32i_smp* smp, const char* imem_file, const char* dmem_file);
+void rv32i_smp_reset(rv32i_smp* smp);	// after loading through rv32i_smp_hart(smp, 0)
+void rv32i_smp_set_quantum(rv32i_smp* smp, uint64_t cycles);	// cycles between synchronizations of the harts
+void rv32i_smp_set_deterministic(rv32i_smp* smp, int on);	// run round-robin on the calling thread, reproducible
+uint64_t rv32i_smp_run(rv32i_smp* smp, uint64_t max_cycles);	// returns instructions retired by all harts
+int rv32i_smp_harts(rv32i_smp* smp);
+rv32i_core* rv32i_smp_hart(rv32i_smp* smp, int hart);	// callbacks of a hart run on its thread
+int rv32i_smp_halted(rv32i_smp* smp, int hart);
+
+// newlib syscall proxy: ecall handler passing write, read, exit, brk, open/close/lseek/fstat
+// (confined to a sandbox directory) and gettimeofday/times (simulated cycles) to the host
+typedef struct rv32i_sys rv32i_sys;
+rv32i_sys* rv32i_sys_create(rv32i_core* core, const char* sandbox_dir, FILE* console);	// installs the ecall handler
+void rv32i_sys_destroy(rv32i_sys* sys);		// flushes the console
+void rv32i_sys_flush(rv32i_sys* sys);
+int rv32i_sys_exited(rv32i_sys* sys, int* code);	// nonzero once the program called exit
+uint64_t rv32i_sys_unknown(rv32i_sys* sys);	// calls answered with ENOSYS
+
+// guest profiler: every cycle of the single-cycle or pipeline engine is charged to a guest pc,
+// stall/flush bubbles to the instruction that caused them; call stacks follow jal/jalr
+rv32i_prof* rv32i_prof_create(rv32i_core* core);	// attaches to the core
+void rv32i_prof_destroy(rv32i_prof* prof);	// detaches
+int rv32i_prof_load_symbols(rv32i_prof* prof, const char* elf_file);	// returns symbols read or RV32I_ERR_*
+void rv32i_prof_report(rv32i_prof* prof, FILE* fp, int top);	// the top hottest pcs and functions
+void rv32i_prof_folded(rv32i_prof* prof, FILE* fp);	// folded stacks ("f;g;h cycles") for flamegraph.pl
+
+// pipeline viewer log: the cycles every instruction of the pipeline engine spent in each stage,
+// stalls and flushed instructions included, in the Kanata format of Konata
+rv32i_view* rv32i_view_create(rv32i_core* core, FILE* fp);	// attaches to the core
+void rv32i_view_destroy(rv32i_view* view);	// detaches, fp stays open
+
+// reverse execution of the single-cycle engine: an undo log of the old value of every write in a ring
+// of log_bytes, and a checkpoint of the registers and dmem every interval cycles (0: 100000), see undo.c
+struct rv32i_undo_stop {	// rv32i_undo_reverse stops before the instruction at pc addr (write 0),
+	uint32_t addr;			// or before the last one writing a byte of [addr, addr + len) (write 1)
+	uint32_t len;
+	uint8_t write;
+};
+
+rv32i_undo* rv32i_undo_create(rv32i_core* core, uint32_t log_bytes, uint64_t interval);	// attaches to the core, NULL unless a lone single-cycle core
+void rv32i_undo_destroy(rv32i_undo* undo);	// detaches
+uint64_t rv32i_undo_first(rv32i_undo* undo);	// the earliest cycle the core can go back to
+uint64_t rv32i_undo_goto(rv32i_undo* undo, uint64_t cycle);	// the state before cycle (forward: runs), returns the cycle reached
+int rv32i_undo_reverse(rv32i_undo* undo, const struct rv32i_undo_stop* stop, int n);	// returns the stop, -1 at the earliest cycle
+
+// gdb remote stub: breakpoints, watchpoints, single-step and register/memory access of the
+// single-cycle and pipeline engines, see gdbstub.c
+rv32i_gdb* rv32i_gdb_create(rv32i_core* core, const char* address);	// listens on "[host]:port" (loopback by default) or a Unix socket path, NULL on error
+int rv32i_gdb_serve(rv32i_gdb* gdb);	// waits for gdb and runs the core for it until it detaches or kills, returns 0 or -1
+void rv32i_gdb_destroy(rv32i_gdb* gdb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,636 @@
+/* **************************************
+ * Module: out-of-order engine (timing model)
+ *
+ * - Tomasulo issue with a reorder buffer (ROB_SIZE) and register renaming
+ * - one reservation station (RS_SIZE) per functional unit:
+ *   ALU_NUM ALUs, a branch unit and an address generation unit
+ * - load/store queue (LSQ_SIZE): loads wait for older store addresses and
+ *   take store data by forwarding, stores write dmem at retirement
+ * - branches are predicted not-taken and recovered when they execute
+ * - ecall/ebreak dispatch alone into an empty ROB and trap then
+ * - every retired instruction is checked against a single-cycle reference
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+#include <string.h>
+
+// functional units, each with its own reservation station
+#define FU_BRU	ALU_NUM
+#define FU_AGU	(ALU_NUM + 1)
+#define FU_NUM	(ALU_NUM + 2)
+
+// reasons a dispatch slot is left empty
+enum dispatch_loss_t {
+	DLOSS_FETCH = 0,	// fetch queue is empty
+	DLOSS_MISPREDICT,	// refetching after a mispredicted branch
+	DLOSS_ROB,			// reorder buffer is full
+	DLOSS_RS_ALU,		// ALU reservation stations are full
+	DLOSS_RS_BRU,		// branch reservation station is full
+	DLOSS_RS_AGU,		// load/store reservation station is full
+	DLOSS_LSQ,			// load/store queue is full
+	DLOSS_TRAP,			// ecall/ebreak waiting for the ROB to drain, or the younger ones after it
+	DLOSS_NUM
+};
+
+static const char* dloss_name[DLOSS_NUM] = {
+	"fetch", "mispredict", "rob full", "rs full (alu)", "rs full (bru)", "rs full (agu)", "lsq full", "trap"
+};
+
+// what the ROB head was waiting on when a retire slot was left empty
+enum retire_loss_t {
+	RLOSS_EMPTY = 0, RLOSS_ALU, RLOSS_BRU, RLOSS_LOAD, RLOSS_STORE, RLOSS_NUM
+};
+
+static const char* rloss_name[RLOSS_NUM] = { "rob empty", "alu", "branch", "load", "store" };
+
+// result latch at the output of a functional unit (all units have 1 cycle latency)
+typedef struct {
+	uint8_t valid;
+	uint8_t rob;
+	uint64_t seq;
+	struct exec_output_t out;
+} fu_latch;
+
+// retirement record of the single-cycle reference
+typedef struct {
+	uint32_t pc;
+	uint8_t rd;
+	uint8_t reg_write;
+	uint32_t rd_din;
+	uint8_t mem_write;
+	uint32_t addr;
+	uint32_t dmem_din;
+} golden_commit;
+
+// retirement that didn't match the reference
+#define MISMATCH_LOG 10
+typedef struct {
+	uint64_t cycle;
+	uint32_t pc;
+	uint8_t rd;
+	uint32_t rd_din;
+	golden_commit ref;
+} retire_mismatch;
+
+static uint8_t fu_class(struct decoder_output_t* ctrl)
+{
+	int i;
+	for (i = 0; i < 7; i++) if (ctrl->branch[i]) return FU_BRU;
+	if (ctrl->mem_read || ctrl->mem_write) return FU_AGU;
+	return 0;
+}
+
+static uint32_t store_data(uint8_t funct3, uint32_t rs2_dout)
+{
+	if (funct3 == 0) return rs2_dout & 0xff;	//sb
+	else if (funct3 == 1) return rs2_dout & 0xffff;	//sh
+	return rs2_dout;	//sw
+}
+
+// single-cycle reference: executes the next instruction on its own copy of the architectural state
+static golden_commit golden_step(uint32_t* pc, uint32_t* imem_data, uint32_t imem_depth, uint32_t* reg_data, uint32_t* dmem_data, uint32_t dmem_depth)
+{
+	struct imem_input_t imem_in = { 0 };
+	struct rf_input_t regfile_in = { 0 };
+	struct rf_output_t regfile_out = { 0 };
+	struct dmem_input_t dmem_in = { 0 };
+	struct decoder_input_t decoder_in = { 0 };
+	struct exec_input_t exec_in = { 0 };
+	struct exec_output_t exec_out = { 0 };
+	golden_commit commit = { 0 };
+
+	imem_in.imem_data = imem_data;
+	regfile_in.rf_data = reg_data;
+	dmem_in.dmem_data = dmem_data;
+
+	// all-zero words aren't part of the program (the timing model doesn't fetch them either)
+	for (decoder_in.inst = 0; decoder_in.inst == 0 && (*pc >> 2) < imem_depth; ) {
+		imem_in.addr = *pc >> 2;
+		decoder_in.inst = imem(imem_in).dout;
+		if (decoder_in.inst == 0) *pc += 4;
+	}
+
+	exec_in.pc = *pc;
+	exec_in.ctrl = decoder(decoder_in);
+	VEC_NOP(exec_in.ctrl);
+	regfile_in.rs1 = exec_in.ctrl.rs1;
+	regfile_in.rs2 = exec_in.ctrl.rs2;
+	regfile_out = regfile(regfile_in);
+	exec_in.rs1_dout = regfile_out.rs1_dout;
+	exec_in.rs2_dout = regfile_out.rs2_dout;
+	exec_out = execute(exec_in);
+
+	commit.pc = *pc;
+	commit.rd = exec_in.ctrl.rd;
+	commit.reg_write = exec_in.ctrl.reg_write;
+	commit.rd_din = exec_out.rd_din;
+
+	dmem_in.addr = exec_out.alu_result >> 2;
+	dmem_in.din = exec_out.dmem_din;
+	dmem_in.mem_read = exec_in.ctrl.mem_read && dmem_in.addr < dmem_depth;	// outside dmem: reads 0, writes are dropped
+	dmem_in.mem_write = exec_in.ctrl.mem_write && dmem_in.addr < dmem_depth;
+	if (exec_in.ctrl.mem_read || exec_in.ctrl.mem_write) {
+		struct dmem_output_t dmem_out = dmem(dmem_in);
+		if (exec_in.ctrl.mem_read) commit.rd_din = load_data(exec_in.ctrl.funct3, dmem_out.dout);
+	}
+	commit.mem_write = exec_in.ctrl.mem_write;
+	commit.addr = exec_out.alu_result;
+	commit.dmem_din = exec_out.dmem_din;
+
+	regfile_in.rd = commit.rd;
+	regfile_in.rd_din = commit.rd_din;
+	regfile_in.reg_write = commit.reg_write;
+	regfile(regfile_in);
+
+	*pc = exec_out.branch_taken ? exec_out.branch_target : *pc + 4;
+	return commit;
+}
+
+struct ooo_state {
+	// architectural state of the single-cycle reference
+	uint32_t golden_pc;
+	uint32_t golden_reg[32];
+	uint32_t* golden_dmem;	// cfg.dmem_depth words
+
+	uint32_t fetch_pc;
+
+	struct imem_input_t imem_in;
+	struct rf_input_t regfile_in;
+	struct dmem_input_t dmem_in;
+	struct dmem_output_t dmem_out;
+	struct decoder_input_t decoder_in;
+	struct exec_input_t exec_in;
+
+	lane_if_id fq[FQ_SIZE];		// fetch queue
+	int fq_count;
+
+	rob_entry rob[ROB_SIZE];
+	int rob_head, rob_count;
+
+	int rat[32];	// rename table: rob index of the newest producer, -1 if the value is in the regfile
+
+	rs_entry rs[FU_NUM][RS_SIZE];
+
+	lsq_entry lsq[LSQ_SIZE];
+	int lsq_head, lsq_count;
+
+	fu_latch fu[FU_NUM];
+	fu_latch mem_port;	// load data returning from dmem
+
+	uint64_t seq;
+	uint8_t recovering;
+
+	// statistics
+	uint64_t dispatch_loss[DLOSS_NUM];
+	uint64_t retire_loss[RLOSS_NUM];
+	uint64_t fu_busy[FU_NUM];
+	uint64_t mispredicts;
+	uint64_t load_forwards;
+	uint64_t mismatches;
+	retire_mismatch mismatch_log[MISMATCH_LOG];
+	uint64_t last_retire;	// cycles until the last retirement
+};
+
+static void ooo_reset(rv32i_core* core)
+{
+	struct ooo_state* s = (struct ooo_state*)core->state;
+	int i;
+
+	s->fetch_pc = core->entry;
+	s->golden_pc = core->entry;
+	memcpy(s->golden_reg, core->reg_data, sizeof(s->golden_reg));
+	s->golden_dmem = (uint32_t*)malloc(core->cfg.dmem_depth * sizeof(uint32_t));
+	memcpy(s->golden_dmem, core->dmem_data, core->cfg.dmem_depth * sizeof(uint32_t));
+
+	s->imem_in.imem_data = core->imem_data;
+	s->regfile_in.rf_data = core->reg_data;
+	s->dmem_in.dmem_data = core->dmem_data;
+
+	for (i = 0; i < 32; i++) s->rat[i] = -1;
+}
+
+static void ooo_destroy(rv32i_core* core)
+{
+	free(((struct ooo_state*)core->state)->golden_dmem);
+}
+
+static void ooo_cycle(rv32i_core* core)
+{
+	struct ooo_state* s = (struct ooo_state*)core->state;
+	int i, k;
+
+	uint8_t busy = (s->rob_count != 0 || s->fq_count != 0);
+
+	//Retire: in order from the ROB head, checked against the reference
+	int retire_slots = ISSUE_WIDTH;
+	while (retire_slots > 0 && s->rob_count > 0 && s->rob[s->rob_head].done) {
+		rob_entry* e = &s->rob[s->rob_head];
+
+		uint32_t st_addr = 0, st_din = 0;
+		if (e->ctrl.mem_write) {
+			lsq_entry* l = &s->lsq[e->lsq];
+			st_addr = l->addr;
+			st_din = store_data(l->funct3, l->data.value);
+			s->dmem_in.addr = st_addr >> 2;
+			s->dmem_in.din = st_din;
+			s->dmem_in.mem_read = 0;
+			s->dmem_in.mem_write = s->dmem_in.addr < core->cfg.dmem_depth;	// outside dmem: dropped
+			dmem(s->dmem_in);
+			rv32i_core_mem(core, e->pc, st_addr, st_din, 1);
+		}
+		if (e->ctrl.mem_read || e->ctrl.mem_write) {
+			s->lsq[s->lsq_head].valid = 0;
+			s->lsq_head = (s->lsq_head + 1) % LSQ_SIZE;
+			s->lsq_count--;
+		}
+
+		s->regfile_in.rd = e->ctrl.rd;
+		s->regfile_in.rd_din = e->rd_din;
+		s->regfile_in.reg_write = e->ctrl.reg_write;
+		regfile(s->regfile_in);
+		rv32i_core_commit(core, e->pc, e->ctrl.rd, e->ctrl.reg_write, e->rd_din);
+		if (e->ctrl.reg_write && s->rat[e->ctrl.rd] == s->rob_head) s->rat[e->ctrl.rd] = -1;
+
+		golden_commit g = golden_step(&s->golden_pc, core->imem_data, core->cfg.imem_depth, s->golden_reg, s->golden_dmem, core->cfg.dmem_depth);
+		if (g.pc != e->pc || (g.reg_write && g.rd != 0 && g.rd_din != e->rd_din) ||
+			(g.mem_write && (g.addr >> 2 != st_addr >> 2 || g.dmem_din != st_din))) {
+			if (s->mismatches < MISMATCH_LOG) {
+				retire_mismatch* m = &s->mismatch_log[s->mismatches];
+				m->cycle = core->cycle;
+				m->pc = e->pc;
+				m->rd = e->ctrl.rd;
+				m->rd_din = e->rd_din;
+				m->ref = g;
+			}
+			s->mismatches++;
+		}
+		if (e->ctrl.trap) {	// the reference takes what the ecall handler did
+			memcpy(s->golden_reg, core->reg_data, sizeof(s->golden_reg));
+			memcpy(s->golden_dmem, core->dmem_data, core->cfg.dmem_depth * sizeof(uint32_t));
+		}
+
+		e->valid = 0;
+		s->rob_head = (s->rob_head + 1) % ROB_SIZE;
+		s->rob_count--;
+		retire_slots--;
+		s->last_retire = core->cycle + 1;
+	}
+
+	if (busy) {
+		enum retire_loss_t reason = RLOSS_EMPTY;
+		if (s->rob_count > 0) {
+			rob_entry* h = &s->rob[s->rob_head];
+			if (h->ctrl.mem_read) reason = RLOSS_LOAD;
+			else if (h->ctrl.mem_write) reason = RLOSS_STORE;
+			else if (fu_class(&h->ctrl) == FU_BRU) reason = RLOSS_BRU;
+			else reason = RLOSS_ALU;
+		}
+		s->retire_loss[reason] += retire_slots;
+	}
+
+	//Writeback: functional unit results go onto the common data bus
+	fu_latch* cdb[FU_NUM + 1];
+	for (i = 0; i < FU_NUM; i++) cdb[i] = &s->fu[i];
+	cdb[FU_NUM] = &s->mem_port;
+
+	int flush_rob = -1;	// oldest mispredicted branch
+	for (i = 0; i <= FU_NUM; i++) {
+		fu_latch* f = cdb[i];
+		if (!f->valid) continue;
+		f->valid = 0;
+		rob_entry* e = &s->rob[f->rob];
+		if (!e->valid || e->seq != f->seq) continue;	// squashed
+
+		if (i == FU_AGU) {	// address generation: fill in the s->lsq entry
+			lsq_entry* l = &s->lsq[e->lsq];
+			l->addr = f->out.alu_result;
+			l->addr_ready = 1;
+			if (l->store && l->data.ready) e->done = 1;
+			continue;
+		}
+
+		e->done = 1;
+		e->rd_din = f->out.rd_din;
+		if (i == FU_BRU && f->out.branch_taken && f->out.branch_target != e->pc + 4) {
+			e->mispredict = 1;
+			e->branch_target = f->out.branch_target;
+			if (flush_rob < 0 || e->seq < s->rob[flush_rob].seq) flush_rob = f->rob;
+		}
+
+		// wake up the waiting operands
+		for (k = 0; k < FU_NUM; k++) {
+			int j;
+			for (j = 0; j < RS_SIZE; j++) {
+				rs_entry* r = &s->rs[k][j];
+				if (!r->valid) continue;
+				if (!r->src1.ready && r->src1.tag == f->rob) {
+					r->src1.ready = 1;
+					r->src1.value = e->rd_din;
+				}
+				if (!r->src2.ready && r->src2.tag == f->rob) {
+					r->src2.ready = 1;
+					r->src2.value = e->rd_din;
+				}
+			}
+		}
+		for (k = 0; k < LSQ_SIZE; k++) {
+			lsq_entry* l = &s->lsq[k];
+			if (l->valid && l->store && !l->data.ready && l->data.tag == f->rob) {
+				l->data.ready = 1;
+				l->data.value = e->rd_din;
+				if (l->addr_ready) s->rob[l->rob].done = 1;
+			}
+		}
+	}
+
+	// branch recovery: drop everything younger than the branch and refetch
+	if (flush_rob >= 0) {
+		uint64_t branch_seq = s->rob[flush_rob].seq;
+
+		while (s->rob_count > 0) {
+			int tail = (s->rob_head + s->rob_count - 1) % ROB_SIZE;
+			if (s->rob[tail].seq <= branch_seq) break;
+			s->rob[tail].valid = 0;
+			s->rob_count--;
+		}
+		while (s->lsq_count > 0) {
+			int tail = (s->lsq_head + s->lsq_count - 1) % LSQ_SIZE;
+			if (s->lsq[tail].seq <= branch_seq) break;
+			s->lsq[tail].valid = 0;
+			s->lsq_count--;
+		}
+		for (k = 0; k < FU_NUM; k++) {
+			for (i = 0; i < RS_SIZE; i++) if (s->rs[k][i].seq > branch_seq) s->rs[k][i].valid = 0;
+		}
+
+		for (i = 0; i < 32; i++) s->rat[i] = -1;
+		for (i = 0; i < s->rob_count; i++) {
+			int idx = (s->rob_head + i) % ROB_SIZE;
+			if (s->rob[idx].ctrl.reg_write && s->rob[idx].ctrl.rd != 0) s->rat[s->rob[idx].ctrl.rd] = idx;
+		}
+
+		s->fq_count = 0;
+		s->fetch_pc = s->rob[flush_rob].branch_target;
+		s->recovering = 1;
+		s->mispredicts++;
+	}
+
+	//Issue: each functional unit starts the oldest ready entry of its reservation station
+	for (k = 0; k < FU_NUM; k++) {
+		int sel = -1;
+		for (i = 0; i < RS_SIZE; i++) {
+			rs_entry* r = &s->rs[k][i];
+			if (r->valid && r->src1.ready && r->src2.ready && (sel < 0 || r->seq < s->rs[k][sel].seq)) sel = i;
+		}
+		if (sel < 0) continue;
+
+		rs_entry* r = &s->rs[k][sel];
+		s->exec_in.pc = r->pc;
+		s->exec_in.rs1_dout = r->src1.value;
+		s->exec_in.rs2_dout = r->src2.value;
+		s->exec_in.ctrl = r->ctrl;
+		s->fu[k].valid = 1;
+		s->fu[k].rob = r->rob;
+		s->fu[k].seq = r->seq;
+		s->fu[k].out = execute(s->exec_in);
+		r->valid = 0;
+		s->fu_busy[k]++;
+	}
+
+	//Memory: the oldest load whose older stores are all resolved reads dmem or takes forwarded data
+	for (i = 0; i < s->lsq_count; i++) {
+		lsq_entry* l = &s->lsq[(s->lsq_head + i) % LSQ_SIZE];
+		if (l->store || l->issued || !l->addr_ready) continue;
+
+		int blocked = 0, fwd = -1;
+		for (k = 0; k < i; k++) {
+			int idx = (s->lsq_head + k) % LSQ_SIZE;
+			lsq_entry* st = &s->lsq[idx];
+			if (!st->store) continue;
+			if (!st->addr_ready) blocked = 1;
+			else if (st->addr >> 2 == l->addr >> 2) fwd = idx;	// youngest older store to the same word
+		}
+		if (blocked || (fwd >= 0 && !s->lsq[fwd].data.ready)) continue;
+
+		uint32_t word;
+		if (fwd >= 0 && l->addr >> 2 < core->cfg.dmem_depth) {
+			word = store_data(s->lsq[fwd].funct3, s->lsq[fwd].data.value);
+			s->load_forwards++;
+		}
+		else {
+			s->dmem_in.addr = l->addr >> 2;
+			s->dmem_in.mem_read = s->dmem_in.addr < core->cfg.dmem_depth;	// outside dmem: reads 0, even behind a store there
+			s->dmem_in.mem_write = 0;
+			s->dmem_out = dmem(s->dmem_in);
+			word = s->dmem_out.dout;
+			rv32i_core_mem(core, s->rob[l->rob].pc, l->addr, word, 0);
+		}
+
+		l->issued = 1;
+		s->mem_port.valid = 1;
+		s->mem_port.rob = l->rob;
+		s->mem_port.seq = l->seq;
+		s->mem_port.out.rd_din = load_data(l->funct3, word);
+		break;	// single dmem read port
+	}
+
+	//Dispatch: decode, rename and allocate in program order
+	int dispatched = 0;
+	enum dispatch_loss_t dloss = s->recovering ? DLOSS_MISPREDICT : DLOSS_FETCH;
+	while (dispatched < ISSUE_WIDTH) {
+		if (s->fq_count == 0) break;
+
+		s->decoder_in.inst = s->fq[0].inst;
+		struct decoder_output_t ctrl = decoder(s->decoder_in);
+		VEC_NOP(ctrl);
+		uint8_t cls = fu_class(&ctrl);
+		uint8_t is_mem = ctrl.mem_read || ctrl.mem_write;
+
+		if (s->rob_count == ROB_SIZE) {
+			dloss = DLOSS_ROB;
+			break;
+		}
+		if (ctrl.trap && s->rob_count > 0) {	// the older instructions retire first
+			dloss = DLOSS_TRAP;
+			break;
+		}
+		if (is_mem && s->lsq_count == LSQ_SIZE) {
+			dloss = DLOSS_LSQ;
+			break;
+		}
+
+		int slot = -1;
+		if (cls == 0) {	// least occupied ALU
+			int best = -1;
+			for (k = 0; k < ALU_NUM; k++) {
+				int free_cnt = 0, first = -1;
+				for (i = 0; i < RS_SIZE; i++) {
+					if (!s->rs[k][i].valid) {
+						free_cnt++;
+						if (first < 0) first = i;
+					}
+				}
+				if (free_cnt > best) {
+					best = free_cnt;
+					cls = k;
+					slot = first;
+				}
+			}
+		}
+		else {
+			for (i = 0; i < RS_SIZE; i++) {
+				if (!s->rs[cls][i].valid) {
+					slot = i;
+					break;
+				}
+			}
+		}
+		if (slot < 0) {
+			dloss = (cls == FU_BRU) ? DLOSS_RS_BRU : (cls == FU_AGU) ? DLOSS_RS_AGU : DLOSS_RS_ALU;
+			break;
+		}
+
+		// rename sources
+		ooo_operand src[2] = { 0 };
+		uint8_t rsn[2] = { ctrl.rs1, ctrl.rs2 };
+		for (i = 0; i < 2; i++) {
+			src[i].ready = 1;
+			if (rsn[i] == 0) continue;
+			if (s->rat[rsn[i]] < 0) src[i].value = core->reg_data[rsn[i]];
+			else if (s->rob[s->rat[rsn[i]]].done) src[i].value = s->rob[s->rat[rsn[i]]].rd_din;
+			else {
+				src[i].ready = 0;
+				src[i].tag = s->rat[rsn[i]];
+			}
+		}
+
+		int r_idx = (s->rob_head + s->rob_count) % ROB_SIZE;
+		rob_entry* e = &s->rob[r_idx];
+		memset(e, 0, sizeof(*e));
+		e->valid = 1;
+		e->seq = s->seq;
+		e->pc = s->fq[0].pc;
+		e->ctrl = ctrl;
+		s->rob_count++;
+
+		rs_entry* r = &s->rs[cls][slot];
+		r->valid = 1;
+		r->rob = r_idx;
+		r->seq = s->seq;
+		r->pc = s->fq[0].pc;
+		r->ctrl = ctrl;
+		r->src1 = src[0];
+		r->src2 = src[1];
+
+		if (is_mem) {	// the agu only needs rs1, store data is tracked in the s->lsq
+			int l_idx = (s->lsq_head + s->lsq_count) % LSQ_SIZE;
+			lsq_entry* l = &s->lsq[l_idx];
+			memset(l, 0, sizeof(*l));
+			l->valid = 1;
+			l->rob = r_idx;
+			l->seq = s->seq;
+			l->store = ctrl.mem_write;
+			l->funct3 = ctrl.funct3;
+			l->data = ctrl.mem_write ? src[1] : (ooo_operand){ 1, 0, 0 };
+			s->lsq_count++;
+			e->lsq = l_idx;
+			r->src2.ready = 1;
+		}
+
+		if (ctrl.reg_write && ctrl.rd != 0) s->rat[ctrl.rd] = r_idx;
+
+		s->seq++;
+		dispatched++;
+		s->recovering = 0;
+		s->fq_count--;
+		memmove(&s->fq[0], &s->fq[1], s->fq_count * sizeof(s->fq[0]));
+
+		// the architectural state is all retired, nothing younger is in flight yet
+		if (ctrl.trap) {
+			rv32i_core_trap(core, e->pc, ctrl.imm32);
+			dloss = DLOSS_TRAP;
+			break;
+		}
+	}
+	if (busy) s->dispatch_loss[dloss] += ISSUE_WIDTH - dispatched;
+
+	//Fetch: sequential (predict not-taken)
+	for (i = 0; i < ISSUE_WIDTH && s->fq_count < FQ_SIZE && (s->fetch_pc >> 2) < core->cfg.imem_depth; i++) {
+		s->imem_in.addr = s->fetch_pc >> 2;
+		uint32_t inst = imem(s->imem_in).dout;
+		if (inst != 0) {	//all-zero words aren't part of the program
+			s->fq[s->fq_count].valid = 1;
+			s->fq[s->fq_count].pc = s->fetch_pc;
+			s->fq[s->fq_count].inst = inst;
+			s->fq_count++;
+		}
+		s->fetch_pc += 4;
+	}
+}
+
+static uint32_t ooo_pc(rv32i_core* core)
+{
+	struct ooo_state* s = (struct ooo_state*)core->state;
+	if (s->rob_count > 0) return s->rob[s->rob_head].pc;	// oldest instruction in flight
+	if (s->fq_count > 0) return s->fq[0].pc;
+	return s->fetch_pc;
+}
+
+static int ooo_report(rv32i_core* core, FILE* fp)
+{
+	struct ooo_state* s = (struct ooo_state*)core->state;
+	uint64_t cycles = s->last_retire;
+	uint64_t retired = core->retired;
+	uint64_t mismatches = s->mismatches;
+	uint64_t dloss_total = 0;
+	int i;
+	for (i = 0; i < DLOSS_NUM; i++) dloss_total += s->dispatch_loss[i];
+
+	for (i = 0; i < MISMATCH_LOG && i < (int)s->mismatches; i++) {
+		retire_mismatch* m = &s->mismatch_log[i];
+		fprintf(fp, "RETIRE MISMATCH cycle %llu: pc %08X (ref %08X) rd x%d %08X (ref %08X)\n",
+			(unsigned long long)m->cycle, m->pc, m->ref.pc, m->rd, m->rd_din, m->ref.rd_din);
+	}
+
+	fputs("\nOUT-OF-ORDER STATS\n", fp);
+	fprintf(fp, "config                 : width %d, rob %d, rs %d x %d, lsq %d\n", ISSUE_WIDTH, ROB_SIZE, RS_SIZE, FU_NUM, LSQ_SIZE);
+	fprintf(fp, "cycles (to last retire): %llu\n", (unsigned long long)cycles);
+	fprintf(fp, "instructions retired   : %llu\n", (unsigned long long)retired);
+	fprintf(fp, "IPC                    : %.3f\n", cycles ? (double)retired / cycles : 0.0);
+	fprintf(fp, "mispredicted branches  : %llu\n", (unsigned long long)s->mispredicts);
+	fprintf(fp, "store-to-load forwards : %llu\n", (unsigned long long)s->load_forwards);
+	fputs("lost dispatch slots:\n", fp);
+	for (i = 0; i < DLOSS_NUM; i++) {
+		fprintf(fp, "  %-14s: %llu (%.1f%%)\n", dloss_name[i], (unsigned long long)s->dispatch_loss[i], dloss_total ? 100.0 * s->dispatch_loss[i] / dloss_total : 0.0);
+	}
+	fputs("lost retire slots (rob head waiting on):\n", fp);
+	for (i = 0; i < RLOSS_NUM; i++) fprintf(fp, "  %-14s: %llu\n", rloss_name[i], (unsigned long long)s->retire_loss[i]);
+	fputs("functional unit busy cycles:\n", fp);
+	for (i = 0; i < FU_NUM; i++) {
+		char name[8];
+		if (i == FU_BRU) strcpy(name, "bru");
+		else if (i == FU_AGU) strcpy(name, "agu");
+		else snprintf(name, sizeof(name), "alu%d", i);
+		fprintf(fp, "  %-14s: %llu\n", name, (unsigned long long)s->fu_busy[i]);
+	}
+
+	// precise state: the retired state must match the reference
+	if (memcmp(core->reg_data, s->golden_reg, sizeof(s->golden_reg)) || memcmp(core->dmem_data, s->golden_dmem, core->cfg.dmem_depth * sizeof(uint32_t))) mismatches++;
+	fprintf(fp, "retirement check       : %s (%llu mismatches)\n", mismatches ? "FAIL" : "PASS", (unsigned long long)mismatches);
+
+	return mismatches ? 1 : 0;
+}
+
+const struct rv32i_engine_ops rv32i_ooo_ops = {
+	"ooo",
+	sizeof(struct ooo_state),
+	ooo_reset,
+	ooo_cycle,
+	ooo_pc,
+	ooo_report,
+	ooo_destroy,
+};
@@ -0,0 +1,698 @@
+/* **************************************
+ * Module: 5-stage pipeline engine (mirrors pipeline_cpu.sv)
+ *
+ * - Everything pipeline_cpu.sv keeps in flip-flops is in one pipeline_regs
+ *   block, double-buffered: cur is the state of this cycle, next becomes cur
+ *   at the clock edge, and a snapshot of the pipeline is one struct copy
+ * - A cycle is three steps: pipeline_eval computes the combinational signals
+ *   (pipeline_wires) from cur alone; the stage_* latches write each their own
+ *   part of next from cur and the wires, so they run in any order
+ *   (rv32i_pipeline_shuffle tests it); pipeline_commit then does the writes
+ *   to the regfile and dmem, the trap and the callbacks, at the clock edge
+ * - ecall/ebreak drain the pipeline and trap from ID
+ * - Knobs of rv32i_config the RTL doesn't have: forwarding off (ID waits for
+ *   the producers to reach WB), branches resolved in ID or MEM instead of EX,
+ *   and the flush optimization off (every taken branch refetches its target)
+ * - Macro-op fusion (rv32i_config.fusion, not in the RTL): IF fetches
+ *   aligned 8-byte blocks and spots the pairs of enum fuse_t in them, ID
+ *   decodes a pair into one instruction, WB retires both halves
+ * - A store takes its data from a load just ahead of it as the load leaves
+ *   MEM, so only the address waits for a load (pipeline_cpu.sv still stalls
+ *   the store); the load-use stalls this saves are counted
+ * - Byte-lane dmem (rv32i_config.byte_lanes, not in the RTL): an
+ *   access whose bytes cross a word stays in MEM a second cycle for the other
+ *   word, the older stages freeze and WB gets a bubble (stage_split)
+ * - Instructions are numbered in IF for the viewer log (pipeview.c)
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+#include <string.h>
+
+// sequential state
+struct pipeline_regs {
+	uint32_t pc_curr;	// program counter
+	pipe_if_id id;
+	pipe_id_ex ex;
+	pipe_ex_mem mem;
+	pipe_mem_wb wb;
+	uint8_t mem_second;	// byte lanes: the access in MEM is in its second cycle
+	uint32_t if_seq;	// model only: number of the instruction in IF, 0 until it is given one
+	uint32_t seq;		// model only: last number given
+};
+
+// combinational signals, computed from cur before anything is written
+struct pipeline_wires {
+	// IF
+	uint32_t inst;
+	uint32_t inst2;		// the other word of the fetch block
+	uint8_t fuse;
+	uint32_t if_seq;	// model only
+	uint8_t pc_write;
+	uint32_t pc_next;
+	// ID
+	struct decoder_output_t ctrl;
+	uint8_t trap;			// ecall/ebreak, taken at the clock edge
+	uint32_t fuse_din;
+	struct rf_output_t regfile_out;
+	uint8_t stall_by_load_use;
+	uint8_t stall_by_raw;		// forwarding off, or operands of a branch resolved in ID
+	uint32_t stall_pc;			// the producer waited for
+	uint8_t if_flush;
+	uint8_t if_stall;
+	uint8_t id_flush;
+	uint8_t id_stall;
+	uint8_t ex_flush;
+	// branch resolution, in the stage of rv32i_config.branch_stage
+	uint8_t branch_taken;
+	uint32_t branch_pc;
+	uint32_t pc_next_branch;
+	uint8_t pc_redirect;
+	// EX
+	uint8_t forward_a;
+	uint8_t forward_b;
+	uint8_t forward_store;	// the store data is the load in MEM's
+	uint8_t load_use_saved;	// a store in EX takes it: the stall the hazard unit no longer takes
+	uint32_t alu_fwd_in1;
+	uint32_t alu_fwd_in2;
+	struct alu_output_t alu_out;
+	uint8_t bu_zero;
+	uint8_t bu_sign;
+	uint8_t bu_carry;
+	uint8_t ex_taken;
+	uint32_t ex_target;
+	// MEM
+	uint8_t split;			// byte lanes: first cycle of a word-crossing access
+	struct dmem_input_t dmem_in;
+	struct dmem_output_t dmem_out;	// loads, stores are written at the clock edge
+	// WB
+	uint32_t rd_din;
+};
+
+struct pipeline_state {
+	struct pipeline_regs regs[2];
+	uint8_t cur;		// regs[cur] is the state of this cycle, regs[!cur] the next one
+	struct pipeline_wires w;
+	uint32_t cc;		// clock count
+	uint32_t shuffle;	// tests: state of the random stage order, 0 for the fixed one
+	uint64_t fused[FUSE_NUM];	// pairs retired, per enum fuse_t
+	uint64_t load_use_saved;	// stores that took their data from the load ahead of them instead of stalling
+};
+
+static const char* const fuse_name[FUSE_NUM] = { "", "lui+addi", "auipc+jalr", "auipc+lw", "auipc+sw", "slli+srli" };
+
+// the pair reads pc instead of rs1
+#define FUSE_PCREL(f) ((f) == FUSE_AUIPC_JALR || (f) == FUSE_AUIPC_LW || (f) == FUSE_AUIPC_SW)
+
+static void pipeline_reset(rv32i_core* core)
+{
+	struct pipeline_state* s = (struct pipeline_state*)core->state;
+
+	s->cc = 2;	// clock count
+	s->regs[s->cur].pc_curr = core->entry;
+}
+
+// the value the instruction in WB writes back
+static uint32_t wb_result(const struct pipeline_regs* c)
+{
+	if (c->wb.ub) return c->wb.pc + (c->wb.fuse ? 8 : 4);	// a fused call links past the pair
+	if (c->wb.fuse == FUSE_AUIPC_SW) return c->wb.fuse_din;
+	if (c->wb.mem_to_reg) return load_data(c->wb.funct3, c->wb.dmem_dout);
+	if (c->wb.slt)
+	{
+		if (c->wb.opcode == 0x33 && c->wb.funct3 == 3) return c->wb.carry;	//sltu
+		return c->wb.sign;
+	}
+	if (c->wb.opcode == 0x37) return c->wb.imm32 << 12;	//lui
+	return c->wb.alu_result;
+}
+
+// the value the instruction in MEM will write back (loads excepted, they stall their users but a store's data)
+static uint32_t mem_result(const struct pipeline_regs* c)
+{
+	if (c->mem.ub) return c->mem.pc + (c->mem.fuse ? 8 : 4);
+	if (c->mem.fuse == FUSE_AUIPC_SW) return c->mem.fuse_din;
+	if (c->mem.slt)
+	{
+		if (c->mem.opcode == 0x33 && c->mem.funct3 == 3) return c->mem.carry;	//sltu
+		return c->mem.sign;
+	}
+	if (c->mem.opcode == 0x37) return c->mem.imm32 << 12;	//lui
+	return c->mem.alu_result;
+}
+
+static uint8_t branch_cond(const uint8_t* branch, uint64_t result)
+{
+	uint8_t zero = ((uint32_t)result == 0);
+	uint8_t sign = (result >> 31) & 0x1;
+	uint8_t carry = (result >> 32) & 0x1;
+
+	if (branch[0]) return zero;
+	else if (branch[1]) return !zero;
+	else if (branch[2]) return sign;
+	else if (branch[3]) return (!sign || zero);
+	else if (branch[4]) return carry;
+	else if (branch[5]) return (!carry || zero);
+	else if (branch[6]) return 1;
+	return 0;
+}
+
+// a taken branch in stage: the younger instructions are the sequential ones after it,
+// they are flushed up to the first one at the target (flush optimization), or all of them and the target is fetched
+static void branch_resolve(rv32i_core* core, struct pipeline_wires* w, const struct pipeline_regs* c, int stage, uint32_t pc, uint32_t target)
+{
+	const uint32_t younger_pc[] = { c->pc_curr, c->id.pc, c->ex.pc };
+	const uint8_t younger_valid[] = { 1, c->id.valid, c->ex.valid };
+	uint8_t* flush[] = { &w->if_flush, &w->id_flush, &w->ex_flush };
+
+	w->branch_taken = 1;
+	w->branch_pc = pc;
+	for (int i = stage - 1; i >= RV32I_STAGE_IF; i--) {
+		if (core->cfg.flush_opt && younger_valid[i] && younger_pc[i] == target) return;	// already fetched
+		*flush[i] = 1;
+	}
+	w->pc_next_branch = target;
+	w->pc_redirect = 1;
+}
+
+// dmem is read here and written by pipeline_commit
+static void eval_mem(rv32i_core* core, struct pipeline_wires* w, const struct pipeline_regs* c)
+{
+	w->dmem_in.addr = c->mem.alu_result >> 2; //32bit-dmem
+	if (c->mem.funct3 == 0) w->dmem_in.din = c->mem.rs2_dout & 0xff;	//sb
+	else if (c->mem.funct3 == 1) w->dmem_in.din = c->mem.rs2_dout & 0xffff;	//sh
+	else w->dmem_in.din = c->mem.rs2_dout;	//sw
+	w->dmem_in.mem_read = c->mem.mem_read && w->dmem_in.addr < core->cfg.dmem_depth;	// outside dmem: reads 0, writes are dropped
+	w->dmem_in.mem_write = c->mem.mem_write && w->dmem_in.addr < core->cfg.dmem_depth;
+	w->dmem_in.dmem_data = core->dmem_data;
+
+	if (!core->cfg.byte_lanes) {
+		struct dmem_input_t read_in = w->dmem_in;
+		read_in.mem_write = 0;
+		w->dmem_out = dmem(read_in);
+	}
+	else if (c->mem.mem_read && !c->mem.mem_write) w->dmem_out.dout = rv32i_core_load_lanes(core, c->mem.alu_result, LANES_SIZE(c->mem.funct3));
+
+	if (core->cfg.branch_stage == RV32I_STAGE_MEM && c->mem.valid && c->mem.taken) branch_resolve(core, w, c, RV32I_STAGE_MEM, c->mem.pc, c->mem.target);
+}
+
+static void stage_mem(const struct pipeline_wires* w, const struct pipeline_regs* c, struct pipeline_regs* n)
+{
+	//MEM - WB pipeline register
+	n->mem_second = 0;
+	n->wb.alu_result = c->mem.alu_result;
+	n->wb.dmem_dout = w->dmem_out.dout;
+	n->wb.rd = c->mem.rd;
+	n->wb.reg_write = c->mem.reg_write;
+	n->wb.mem_to_reg = c->mem.mem_to_reg;
+	n->wb.funct3 = c->mem.funct3;
+	n->wb.opcode = c->mem.opcode;
+	n->wb.slt = c->mem.slt;
+	n->wb.imm32 = c->mem.imm32;
+	n->wb.pc = c->mem.pc;
+	n->wb.sign = c->mem.sign;
+	n->wb.carry = c->mem.carry;
+	n->wb.ub = c->mem.ub;
+	n->wb.fuse = c->mem.fuse;
+	n->wb.fuse_din = c->mem.fuse_din;
+	n->wb.valid = c->mem.valid;
+	n->wb.blame = c->mem.blame;
+	n->wb.blame_pc = c->mem.blame_pc;
+	n->wb.seq = c->mem.seq;
+}
+
+static uint32_t forward(uint8_t sel, uint32_t rs_dout, const struct pipeline_wires* w, const struct pipeline_regs* c)
+{
+	switch (sel)
+	{
+	case 2: return mem_result(c);	//EX-MEM -> ID-EX
+	case 1: return w->rd_din;		//MEM-WB -> ID-EX
+	default: return rs_dout;
+	}
+}
+
+//Forwarding unit, without it ID holds the users until the value is in the regfile
+static void forward_unit(rv32i_core* core, struct pipeline_wires* w, const struct pipeline_regs* c)
+{
+	if (!core->cfg.forwarding) w->forward_a = 0;
+	else if (c->mem.reg_write && c->mem.rd == c->ex.rs1 && c->mem.rd != 0) w->forward_a = 2;
+	else if (c->wb.reg_write && c->wb.rd == c->ex.rs1 && c->wb.rd != 0) w->forward_a = 1;
+	else w->forward_a = 0;
+
+	if (!core->cfg.forwarding) w->forward_b = 0;
+	else if (c->mem.reg_write && c->mem.rd == c->ex.rs2 && c->mem.rd != 0) w->forward_b = 2;
+	else if (c->wb.reg_write && c->wb.rd == c->ex.rs2 && c->wb.rd != 0) w->forward_b = 1;
+	else w->forward_b = 0;
+
+	w->alu_fwd_in1 = forward(w->forward_a, c->ex.rs1_dout, w, c);
+	w->alu_fwd_in2 = forward(w->forward_b, c->ex.rs2_dout, w, c);
+
+	// a load in MEM only reaches the store data, which doesn't go through the ALU
+	w->forward_store = (w->forward_b == 2) && c->mem.mem_to_reg;
+}
+
+static void eval_ex(rv32i_core* core, struct pipeline_wires* w, const struct pipeline_regs* c)
+{
+	HOST_MARK(core, HOST_HAZARD);
+	forward_unit(core, w, c);
+	HOST_MARK(core, HOST_EXEC);
+
+	struct alu_input_t alu_in;
+	alu_in.in1 = ((c->ex.branch[6] && c->ex.opcode == 0x6f) || c->ex.opcode == 0x17 || FUSE_PCREL(c->ex.fuse)) ? c->ex.pc : w->alu_fwd_in1;	//jal, auipc or a pc-relative pair
+	if (c->ex.opcode == 0x17) alu_in.in2 = c->ex.imm32 << 12;	//auipc, imm32 is the upper immediate like lui's
+	else alu_in.in2 = c->ex.alu_src ? c->ex.imm32 : w->alu_fwd_in2;
+	alu_in.alu_control = c->ex.alu_control;
+	w->alu_out = alu(alu_in);
+	w->load_use_saved = w->forward_store && c->ex.valid && c->ex.mem_write && !w->ex_flush;
+
+	//Branch unit
+	w->bu_zero = (w->alu_out.result == 0);
+	w->bu_sign = (w->alu_out.result >> 31) & 0x1;
+	w->bu_carry = (w->alu_out.result >> 32) & 0x1;
+	w->ex_taken = c->ex.valid && branch_cond(c->ex.branch, w->alu_out.result);
+	w->ex_target = (c->ex.opcode == 0x67) ? (uint32_t)w->alu_out.result : c->ex.pc + (c->ex.imm32 << 1);	//jalr
+	if (core->cfg.branch_stage == RV32I_STAGE_EX && w->ex_taken) branch_resolve(core, w, c, RV32I_STAGE_EX, c->ex.pc, w->ex_target);
+}
+
+static void stage_ex(const struct pipeline_wires* w, const struct pipeline_regs* c, struct pipeline_regs* n)
+{
+	//EX - MEM pipeline register
+	if (w->ex_flush)
+	{
+		memset(&n->mem, 0, sizeof(n->mem));
+		n->mem.blame = CHARGE_FLUSH;
+		n->mem.blame_pc = w->branch_pc;
+		return;
+	}
+	n->mem.alu_result = (uint32_t)w->alu_out.result;
+	n->mem.rs2_dout = w->forward_store ? load_data(c->mem.funct3, w->dmem_out.dout) : w->alu_fwd_in2;    //for store op, inputs for alu and mem are different. imm, reg, respectively.
+	n->mem.mem_read = c->ex.mem_read;
+	n->mem.mem_write = c->ex.mem_write;
+	n->mem.rd = c->ex.rd;
+	n->mem.reg_write = c->ex.reg_write;
+	n->mem.mem_to_reg = c->ex.mem_to_reg;
+	n->mem.funct3 = c->ex.funct3;
+	n->mem.opcode = c->ex.opcode;
+	n->mem.slt = c->ex.slt;
+	n->mem.imm32 = c->ex.imm32;
+	n->mem.pc = c->ex.pc;
+	n->mem.sign = w->bu_sign;
+	n->mem.carry = w->bu_carry;
+	n->mem.ub = c->ex.branch[6];
+	n->mem.fuse = c->ex.fuse;
+	n->mem.fuse_din = c->ex.fuse_din;
+	n->mem.valid = c->ex.valid;
+	n->mem.taken = w->ex_taken;
+	n->mem.target = w->ex_target;
+	n->mem.blame = c->ex.blame;
+	n->mem.blame_pc = c->ex.blame_pc;
+	n->mem.seq = c->ex.seq;
+}
+
+// the pair in ID as one instruction: the control of the second half with the operands of both
+static void fuse_decode(struct decoder_output_t* ctrl, uint32_t* fuse_din, uint8_t fuse, uint32_t inst, uint32_t pc)
+{
+	struct decoder_input_t decoder_in;
+	decoder_in.inst = inst;
+	struct decoder_output_t first = decoder(decoder_in);
+	uint32_t upper = first.imm32 << 12;
+
+	switch (fuse)
+	{
+	case FUSE_LUI_ADDI:
+		ctrl->rs1 = 0;
+		ctrl->imm32 += upper;
+		*fuse_din = upper;
+		break;
+	case FUSE_AUIPC_SW:
+		ctrl->rd = first.rd;	// the store writes what auipc would have
+		ctrl->reg_write = 1;
+		// fall through
+	case FUSE_AUIPC_JALR:
+	case FUSE_AUIPC_LW:
+		ctrl->rs1 = 0;			// EX adds to pc
+		ctrl->imm32 += upper;
+		*fuse_din = pc + upper;
+		break;
+	case FUSE_SLLI_SRLI:
+		ctrl->rs1 = first.rs1;
+		ctrl->imm32 = 0xffffffffu >> ctrl->imm32;
+		ctrl->alu_control = 0;	// and
+		break;
+	}
+}
+
+// rs1 or rs2 of the instruction in ID is written by the one in x
+#define RAW(x) ((x).reg_write && (x).rd != 0 && ((x).rd == w->ctrl.rs1 || (x).rd == w->ctrl.rs2))
+
+static void eval_id(rv32i_core* core, struct pipeline_wires* w, const struct pipeline_regs* c)
+{
+	struct decoder_input_t decoder_in;
+	decoder_in.inst = c->id.fuse ? c->id.inst2 : c->id.inst;
+	w->ctrl = decoder(decoder_in);
+	VEC_NOP(w->ctrl);
+	if (c->id.fuse) fuse_decode(&w->ctrl, &w->fuse_din, c->id.fuse, c->id.inst, c->id.pc);
+	uint8_t is_branch = c->id.valid && memchr(w->ctrl.branch, 1, sizeof(w->ctrl.branch)) != NULL;
+	uint8_t ex_live = !w->ex_flush;	// the instruction in EX reaches MEM
+	uint8_t ex_load = ex_live & c->ex.mem_read;
+
+	//Hazard detection unit: a load holds the users of its rd in ID, except a store's data (forward_store)
+	HOST_MARK(core, HOST_HAZARD);
+	uint8_t store_data = w->ctrl.mem_write && core->cfg.forwarding;
+	w->stall_by_load_use = ex_load & (c->ex.rd != 0) & ((c->ex.rd == w->ctrl.rs1) | ((c->ex.rd == w->ctrl.rs2) & !store_data));
+	w->stall_by_raw = 0;
+	w->stall_pc = c->ex.pc;
+	if (!core->cfg.forwarding || (is_branch && core->cfg.branch_stage == RV32I_STAGE_ID))
+	{
+		// the compare in ID gets MEM results forwarded, nothing from EX
+		if (ex_live && RAW(c->ex)) w->stall_by_raw = 1;
+		else if (RAW(c->mem) && (!core->cfg.forwarding || c->mem.mem_read))
+		{
+			w->stall_by_raw = 1;
+			w->stall_pc = c->mem.pc;
+		}
+	}
+
+	w->id_stall = w->stall_by_load_use | w->stall_by_raw;
+	w->if_stall = w->id_stall;
+	HOST_MARK(core, HOST_DECODE);
+
+	//ecall/ebreak (model only): wait in ID until the older instructions are done, then trap
+	if (c->id.valid && w->ctrl.trap && !w->id_flush) {
+		if (c->ex.valid || c->mem.valid) {
+			w->id_stall = w->if_stall = 1;
+			w->stall_pc = c->id.pc;
+		}
+		else w->trap = 1;
+	}
+
+	//Register file, its internal forwarding passes the value WB writes at this clock edge
+	struct rf_input_t regfile_in;
+	regfile_in.rs1 = w->ctrl.rs1;
+	regfile_in.rs2 = w->ctrl.rs2;
+	regfile_in.rd = c->wb.rd;
+	regfile_in.rd_din = w->rd_din;
+	regfile_in.reg_write = 0;	// pipeline_commit writes it
+	regfile_in.rf_data = core->reg_data;
+	w->regfile_out = regfile(regfile_in);
+	if (c->wb.reg_write && c->wb.rd != 0) {
+		if (w->ctrl.rs1 == c->wb.rd) w->regfile_out.rs1_dout = w->rd_din;
+		if (w->ctrl.rs2 == c->wb.rd) w->regfile_out.rs2_dout = w->rd_din;
+	}
+
+	//Branch resolved in ID, on the regfile values and the MEM result
+	if (core->cfg.branch_stage == RV32I_STAGE_ID && is_branch && !w->id_flush && !w->id_stall)
+	{
+		uint32_t rs1 = (RAW(c->mem) && c->mem.rd == w->ctrl.rs1) ? mem_result(c) : w->regfile_out.rs1_dout;
+		uint32_t rs2 = (RAW(c->mem) && c->mem.rd == w->ctrl.rs2) ? mem_result(c) : w->regfile_out.rs2_dout;
+		struct alu_input_t alu_in;
+		alu_in.in1 = (w->ctrl.opcode == 0x6f || FUSE_PCREL(c->id.fuse)) ? c->id.pc : rs1;
+		alu_in.in2 = w->ctrl.alu_src ? w->ctrl.imm32 : rs2;
+		alu_in.alu_control = w->ctrl.alu_control;
+		struct alu_output_t alu_out = alu(alu_in);
+		if (branch_cond(w->ctrl.branch, alu_out.result))
+			branch_resolve(core, w, c, RV32I_STAGE_ID, c->id.pc, (w->ctrl.opcode == 0x67) ? (uint32_t)alu_out.result : c->id.pc + (w->ctrl.imm32 << 1));
+	}
+}
+
+#undef RAW
+
+static void stage_id(const struct pipeline_wires* w, const struct pipeline_regs* c, struct pipeline_regs* n)
+{
+	//ID - EX pipeline register
+	if (w->id_flush)
+	{
+		memset(&n->ex, 0, sizeof(n->ex));
+		n->ex.blame = CHARGE_FLUSH;
+		n->ex.blame_pc = w->branch_pc;
+	}
+	else if (!w->id_stall)
+	{
+		n->ex.pc = c->id.pc; //current inst's pc
+		n->ex.rs1_dout = w->regfile_out.rs1_dout;
+		n->ex.rs2_dout = w->regfile_out.rs2_dout;
+		n->ex.imm32 = w->ctrl.imm32;
+		n->ex.opcode = w->ctrl.opcode;
+		n->ex.funct3 = w->ctrl.funct3;
+		n->ex.funct7 = w->ctrl.funct7;
+		memcpy(n->ex.branch, w->ctrl.branch, sizeof(w->ctrl.branch));
+		n->ex.alu_src = w->ctrl.alu_src;
+		n->ex.alu_op = w->ctrl.alu_op;
+		n->ex.alu_control = w->ctrl.alu_control;
+		n->ex.slt = w->ctrl.slt;
+		n->ex.mem_read = w->ctrl.mem_read;
+		n->ex.mem_write = w->ctrl.mem_write;
+		n->ex.rs1 = w->ctrl.rs1;
+		n->ex.rs2 = w->ctrl.rs2;
+		n->ex.rd = w->ctrl.rd;
+		n->ex.reg_write = w->ctrl.reg_write;
+		n->ex.mem_to_reg = w->ctrl.mem_to_reg;
+		n->ex.fuse = c->id.fuse;
+		n->ex.fuse_din = w->fuse_din;
+		n->ex.valid = c->id.valid;
+		n->ex.blame = c->id.blame;
+		n->ex.blame_pc = c->id.blame_pc;
+		n->ex.seq = c->id.seq;
+	}
+	else
+	{  //if stall, a bubble goes down the pipeline
+		memset(&n->ex, 0, sizeof(n->ex));
+		n->ex.blame = CHARGE_STALL;	// the producer in EX or MEM, or the ecall waiting in ID
+		n->ex.blame_pc = w->stall_pc;
+	}
+}
+
+// the pair of words a, b that fuses, in enum fuse_t
+static uint8_t fuse_kind(uint32_t a, uint32_t b)
+{
+	uint32_t a_op = a & 0x7f, a_rd = (a >> 7) & 0x1f, a_f3 = (a >> 12) & 0x7;
+	uint32_t b_op = b & 0x7f, b_rd = (b >> 7) & 0x1f, b_f3 = (b >> 12) & 0x7, b_rs1 = (b >> 15) & 0x1f, b_rs2 = (b >> 20) & 0x1f;
+
+	if (a_rd == 0 || b_rs1 != a_rd) return FUSE_NONE;	// the second half consumes the first's result
+	if (a_op == 0x37 && b_op == 0x13 && b_f3 == 0 && b_rd == a_rd) return FUSE_LUI_ADDI;
+	if (a_op == 0x17 && b_op == 0x67 && b_rd == a_rd) return FUSE_AUIPC_JALR;
+	if (a_op == 0x17 && b_op == 0x03 && b_f3 == 2 && b_rd == a_rd) return FUSE_AUIPC_LW;
+	if (a_op == 0x17 && b_op == 0x23 && b_f3 == 2 && b_rs2 != a_rd) return FUSE_AUIPC_SW;
+	if (a_op == 0x13 && a_f3 == 1 && (a >> 25) == 0 && b_op == 0x13 && b_f3 == 5 && (b >> 25) == 0 && b_rd == a_rd
+		&& ((a >> 20) & 0x1f) == b_rs2) return FUSE_SLLI_SRLI;	// same shift amount
+	return FUSE_NONE;
+}
+
+static void eval_if(rv32i_core* core, struct pipeline_wires* w, const struct pipeline_regs* c)
+{
+	struct imem_input_t imem_in;
+	imem_in.addr = c->pc_curr >> 2;
+	imem_in.imem_data = core->imem_data;
+	w->inst = (imem_in.addr < core->cfg.imem_depth) ? imem(imem_in).dout : 0;	// past the end of imem: a bubble
+
+	//Fusion: the second word must be in the same 8-byte fetch block, whose upper word IF reads alongside the lower one
+	if ((c->pc_curr >> 2 | 1) < core->cfg.imem_depth)
+	{
+		imem_in.addr |= 1;
+		w->inst2 = imem(imem_in).dout;
+		if (core->cfg.fusion && !(c->pc_curr & 4)) w->fuse = fuse_kind(w->inst, w->inst2);
+	}
+
+	w->if_seq = c->if_seq;
+	if (!w->if_seq && w->inst) w->if_seq = c->seq + 1;
+
+	//Program counter: a flush overrides the stall of the instruction in ID
+	if (w->id_flush) w->if_stall = 0;
+	w->pc_write = w->pc_redirect || !w->if_stall;
+	w->pc_next = w->pc_redirect ? w->pc_next_branch : c->pc_curr + (w->fuse ? 8 : 4);
+}
+
+static void stage_if(const struct pipeline_wires* w, const struct pipeline_regs* c, struct pipeline_regs* n)
+{
+	if (w->if_seq != c->if_seq) n->seq = w->if_seq;	// the instruction in IF got a new number
+	if (w->pc_write) n->pc_curr = w->pc_next;
+
+	//IF - ID pipeline register
+	if (w->if_flush) {
+		memset(&n->id, 0, sizeof(n->id));
+		n->id.blame = CHARGE_FLUSH;
+		n->id.blame_pc = w->branch_pc;
+	}
+	else if (!w->if_stall)
+	{
+		n->id.pc = c->pc_curr;
+		n->id.inst = w->inst;
+		n->id.inst2 = w->inst2;
+		n->id.fuse = w->fuse;
+		n->id.valid = (w->inst != 0);
+		n->id.blame = 0;
+		n->id.seq = w->if_seq;
+	}
+	n->if_seq = (!w->if_flush && w->if_stall) ? w->if_seq : 0;	// held in IF, otherwise the next fetch gets a new number
+}
+
+// byte lanes: the load/store in MEM crosses a word and hasn't had its first cycle
+static uint8_t mem_split(const rv32i_core* core, const struct pipeline_regs* c)
+{
+	return core->cfg.byte_lanes && (c->mem.mem_read || c->mem.mem_write) && !c->mem_second
+		&& LANES_CROSS(c->mem.alu_result, LANES_SIZE(c->mem.funct3));
+}
+
+// first cycle of a word-crossing access: MEM reads the lower word, the access completes in the second;
+// WB retires into a bubble, so EX keeps the operands it has forwarded from there
+static void eval_split(rv32i_core* core, struct pipeline_wires* w, const struct pipeline_regs* c)
+{
+	forward_unit(core, w, c);
+
+	w->if_seq = c->if_seq;	// IF holds, the viewer still numbers its instruction
+	if (!w->if_seq && (c->pc_curr >> 2) < core->cfg.imem_depth && core->imem_data[c->pc_curr >> 2]) w->if_seq = c->seq + 1;
+}
+
+static void stage_split(const struct pipeline_wires* w, const struct pipeline_regs* c, struct pipeline_regs* n)
+{
+	n->ex.rs1_dout = w->alu_fwd_in1;
+	n->ex.rs2_dout = w->alu_fwd_in2;
+
+	n->mem_second = 1;
+	memset(&n->wb, 0, sizeof(n->wb));
+	n->wb.blame = CHARGE_STALL;
+	n->wb.blame_pc = c->mem.pc;
+
+	if (w->if_seq != c->if_seq) n->if_seq = n->seq = w->if_seq;
+}
+
+// the combinational signals of the cycle, from cur alone; each unit uses those of the older stages
+static void pipeline_eval(rv32i_core* core, struct pipeline_wires* w, const struct pipeline_regs* c)
+{
+	memset(w, 0, sizeof(*w));
+	HOST_MARK(core, HOST_WB);
+	w->rd_din = wb_result(c);
+	HOST_MARK(core, HOST_MEM);
+	w->split = mem_split(core, c);
+	if (w->split) {
+		eval_split(core, w, c);
+		return;
+	}
+	eval_mem(core, w, c);
+	HOST_MARK(core, HOST_EXEC);
+	eval_ex(core, w, c);
+	HOST_MARK(core, HOST_DECODE);
+	eval_id(core, w, c);
+	HOST_MARK(core, HOST_FETCH);
+	eval_if(core, w, c);
+}
+
+// the writes of the cycle to the registers and dmem, the trap and the callbacks, at the clock edge
+static void pipeline_commit(rv32i_core* core, struct pipeline_state* s, const struct pipeline_wires* w, const struct pipeline_regs* c)
+{
+	HOST_MARK(core, HOST_WB);
+	if (c->wb.reg_write) core->reg_data[c->wb.rd] = w->rd_din;
+
+	if (c->wb.valid) rv32i_core_charge(core, c->wb.pc, CHARGE_EXEC);
+	else rv32i_core_charge(core, c->wb.blame_pc, c->wb.blame ? c->wb.blame : CHARGE_IDLE);
+	if (c->wb.valid && c->wb.fuse) {
+		// the first half retires with the value it would have written: lui/auipc, or slli = the and's result << n
+		uint32_t first = (c->wb.fuse == FUSE_SLLI_SRLI) ? w->rd_din << __builtin_clz(c->wb.imm32) : c->wb.fuse_din;
+		rv32i_core_commit(core, c->wb.pc, c->wb.rd, 1, first);
+		if (c->wb.fuse == FUSE_AUIPC_SW) rv32i_core_commit(core, c->wb.pc + 4, 0, 0, 0);
+		else rv32i_core_commit(core, c->wb.pc + 4, c->wb.rd, c->wb.reg_write, w->rd_din);
+		s->fused[c->wb.fuse]++;
+		core->fused++;
+	}
+	else if (c->wb.valid) rv32i_core_commit(core, c->wb.pc, c->wb.rd, c->wb.reg_write, w->rd_din);
+	if (w->split) return;	// nothing reached dmem or ID
+
+	HOST_MARK(core, HOST_MEM);
+	if (!core->cfg.byte_lanes) {
+		if (w->dmem_in.mem_write) dmem(w->dmem_in);
+	}
+	else if (c->mem.mem_write) rv32i_core_store_lanes(core, c->mem.alu_result, LANES_SIZE(c->mem.funct3), w->dmem_in.din);
+	if (c->mem.valid && (c->mem.mem_read || c->mem.mem_write)) rv32i_core_mem(core, c->mem.pc + (c->mem.fuse ? 4 : 0), c->mem.alu_result, c->mem.mem_write ? w->dmem_in.din : w->dmem_out.dout, c->mem.mem_write);
+	if (core->trace) {
+		int prev = HOST_ENTER(core, HOST_IO);
+		fprintf(core->trace, "DMEM address : %x\n", w->dmem_in.addr);
+		fprintf(core->trace, "DMEM READ : %d\n", w->dmem_in.mem_read);
+		fprintf(core->trace, "DMEM output : %x\n", w->dmem_out.dout);
+		HOST_LEAVE(core, prev);
+	}
+
+	s->load_use_saved += w->load_use_saved;
+
+	HOST_MARK(core, HOST_DECODE);
+	if (w->trap) rv32i_core_trap(core, c->id.pc, w->ctrl.imm32);
+}
+
+// the pipeline registers of the stages but WB, which has none; each writes only its own
+#define LATCH_NUM 4
+static void (*const stage_latch[LATCH_NUM])(const struct pipeline_wires* w, const struct pipeline_regs* c, struct pipeline_regs* n) = {
+	stage_mem, stage_ex, stage_id, stage_if
+};
+
+static void pipeline_cycle(rv32i_core* core)
+{
+	struct pipeline_state* s = (struct pipeline_state*)core->state;
+	const struct pipeline_regs* c = &s->regs[s->cur];
+	struct pipeline_regs* n = &s->regs[!s->cur];
+	int order[LATCH_NUM] = { 0, 1, 2, 3 };
+
+	pipeline_eval(core, &s->w, c);
+	HOST_MARK(core, HOST_OTHER);
+	*n = *c;	// registers not written this cycle hold their value
+	if (s->w.split) stage_split(&s->w, c, n);
+	else {
+		for (int i = LATCH_NUM - 1; s->shuffle && i > 0; i--) {	// xorshift32, Fisher-Yates
+			s->shuffle ^= s->shuffle << 13;
+			s->shuffle ^= s->shuffle >> 17;
+			s->shuffle ^= s->shuffle << 5;
+			int k = s->shuffle % (i + 1), t = order[i];
+			order[i] = order[k];
+			order[k] = t;
+		}
+		for (int i = 0; i < LATCH_NUM; i++) stage_latch[order[i]](&s->w, c, n);
+	}
+	pipeline_commit(core, s, &s->w, c);
+	HOST_MARK(core, HOST_OTHER);
+
+	if (core->view) {
+		rv32i_view_stage(core->view, 0, s->w.if_seq, c->pc_curr);
+		rv32i_view_stage(core->view, 1, c->id.seq, c->id.pc);
+		rv32i_view_stage(core->view, 2, c->ex.seq, c->ex.pc);
+		rv32i_view_stage(core->view, 3, c->mem.seq, c->mem.pc);
+		rv32i_view_stage(core->view, 4, c->wb.seq, c->wb.pc);
+		rv32i_view_cycle(core->view);
+	}
+
+	s->cur = !s->cur;	// clock edge
+	s->cc++;
+}
+
+void rv32i_pipeline_shuffle(rv32i_core* core, uint32_t seed)
+{
+	if (core->ops == &rv32i_pipeline_ops) ((struct pipeline_state*)core->state)->shuffle = seed;
+}
+
+static int pipeline_report(rv32i_core* core, FILE* fp)
+{
+	struct pipeline_state* s = (struct pipeline_state*)core->state;
+
+	fputs("\nPIPELINE STATS\n", fp);
+	fprintf(fp, "fused pairs            : %llu (%.1f%% of instructions retired)\n", (unsigned long long)core->fused,
+		core->retired ? 200.0 * core->fused / core->retired : 0.0);
+	for (int i = FUSE_NONE + 1; i < FUSE_NUM; i++) fprintf(fp, "  %-10s: %llu\n", fuse_name[i], (unsigned long long)s->fused[i]);
+	fprintf(fp, "load-use stalls avoided: %llu (store data forwarded from the load)\n", (unsigned long long)s->load_use_saved);
+	return 0;
+}
+
+static uint32_t pipeline_pc(rv32i_core* core)
+{
+	struct pipeline_state* s = (struct pipeline_state*)core->state;
+	return s->regs[s->cur].pc_curr;
+}
+
+const struct rv32i_engine_ops rv32i_pipeline_ops = {
+	"pipeline",
+	sizeof(struct pipeline_state),
+	pipeline_reset,
+	pipeline_cycle,
+	pipeline_pc,
+	pipeline_report,
+	NULL,
+};
@@ -0,0 +1,112 @@
+/* **************************************
+ * Module: pipeline viewer log
+ *
+ * - Kanata log (version 0004) as read by Konata: one row per instruction,
+ *   a column per cycle, the stage it occupied in each
+ * - The engine tells every cycle which instruction is in which stage;
+ *   an instruction staying in a stage is stalled, one leaving W retired,
+ *   one vanishing before W was flushed
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+#include <string.h>
+
+static const char* const view_stage_name[VIEW_STAGES] = { "F", "D", "X", "M", "W" };
+
+struct view_slot {
+	uint32_t seq;		// 0: bubble
+	uint32_t pc;
+	uint64_t id;		// Kanata id, numbered in order of appearance
+};
+
+struct rv32i_view {
+	rv32i_core* core;
+	FILE* fp;
+	uint64_t next_id;
+	uint64_t retired;
+	struct view_slot prev[VIEW_STAGES];	// last cycle
+	struct view_slot cur[VIEW_STAGES];
+};
+
+rv32i_view* rv32i_view_create(rv32i_core* core, FILE* fp)
+{
+	rv32i_view* view = (rv32i_view*)calloc(1, sizeof(rv32i_view));
+	view->core = core;
+	view->fp = fp;
+	fprintf(fp, "Kanata\t0004\nC=\t%llu\n", (unsigned long long)core->cycle);
+	core->view = view;
+	return view;
+}
+
+void rv32i_view_destroy(rv32i_view* view)
+{
+	if (!view) return;
+	if (view->core->view == view) view->core->view = NULL;
+	struct view_slot* w = &view->prev[VIEW_STAGES - 1];	// committed in the last cycle
+	if (w->seq) fprintf(view->fp, "R\t%llu\t%llu\t0\n", (unsigned long long)w->id, (unsigned long long)view->retired);
+	fflush(view->fp);
+	free(view);
+}
+
+// instructions in flight are dropped, the log carries on with the new ones
+void rv32i_view_restart(rv32i_view* view)
+{
+	for (int i = 0; i < VIEW_STAGES; i++) {
+		if (view->prev[i].seq) fprintf(view->fp, "R\t%llu\t0\t1\n", (unsigned long long)view->prev[i].id);
+	}
+	memset(view->prev, 0, sizeof(view->prev));
+	memset(view->cur, 0, sizeof(view->cur));
+}
+
+void rv32i_view_stage(rv32i_view* view, int stage, uint32_t seq, uint32_t pc)
+{
+	view->cur[stage].seq = seq;
+	view->cur[stage].pc = pc;
+}
+
+static struct view_slot* view_find(struct view_slot* slot, uint32_t seq)
+{
+	for (int i = 0; i < VIEW_STAGES; i++) {
+		if (slot[i].seq == seq) return &slot[i];
+	}
+	return NULL;
+}
+
+void rv32i_view_cycle(rv32i_view* view)
+{
+	FILE* fp = view->fp;
+	int i;
+
+	// gone since last cycle
+	for (i = 0; i < VIEW_STAGES; i++) {
+		struct view_slot* p = &view->prev[i];
+		if (!p->seq || view_find(view->cur, p->seq)) continue;
+		if (i == VIEW_STAGES - 1) fprintf(fp, "R\t%llu\t%llu\t0\n", (unsigned long long)p->id, (unsigned long long)view->retired++);
+		else fprintf(fp, "R\t%llu\t0\t1\n", (unsigned long long)p->id);
+	}
+
+	// new, or moved on to the next stage
+	for (i = 0; i < VIEW_STAGES; i++) {
+		struct view_slot* c = &view->cur[i];
+		if (!c->seq) continue;
+		struct view_slot* p = view_find(view->prev, c->seq);
+		if (p) {
+			c->id = p->id;
+			if (p - view->prev == i) continue;
+		}
+		else {
+			uint32_t inst = ((c->pc >> 2) < view->core->cfg.imem_depth) ? view->core->imem_data[c->pc >> 2] : 0;
+			c->id = view->next_id++;
+			fprintf(fp, "I\t%llu\t%u\t%d\n", (unsigned long long)c->id, c->seq, view->core->hart);
+			fprintf(fp, "L\t%llu\t0\t%08X: %-8s (%08X)\n", (unsigned long long)c->id, c->pc, rv32i_inst_name(inst), inst);
+		}
+		fprintf(fp, "S\t%llu\t0\t%s\n", (unsigned long long)c->id, view_stage_name[i]);
+	}
+
+	memcpy(view->prev, view->cur, sizeof(view->prev));
+	fprintf(fp, "C\t1\n");
+}
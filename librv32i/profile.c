@@ -0,0 +1,280 @@
+/* **************************************
+ * Module: guest profiler
+ *
+ * - The engines charge every cycle to one guest pc (rv32i_core_charge):
+ *   the instruction completing, or the instruction that caused the bubble
+ * - Call stacks follow the committed jal/jalr (rd = ra/t0 is a call,
+ *   jalr x0 through ra/t0 a return) and are kept as a tree of frames,
+ *   each frame holding the caller's function
+ * - Per-pc counts, per-function totals and folded stacks
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+#include <string.h>
+
+#define PROF_DEPTH 256	// deeper calls are charged to the deepest frame
+
+struct prof_pc {
+	uint64_t count;		// executions
+	uint64_t cycles;	// all cycles charged to the pc
+	uint64_t stall;		// of which stall bubbles
+	uint64_t flush;		// of which flush bubbles
+};
+
+struct prof_node {
+	int parent;
+	int sym;			// -1: no symbol
+	int depth;
+	uint64_t cycles;	// charged while this was the leaf
+};
+
+struct rv32i_prof {
+	rv32i_core* core;
+	struct prof_pc* pc;	// per imem word
+	uint64_t idle;		// cycles nobody caused
+	uint64_t cycles;
+
+	struct rv32i_sym* syms;
+	int sym_num;
+
+	struct prof_node* node;	// node 0 is the root (empty stack)
+	int node_num, node_cap;
+	int* hash;			// (parent, sym) -> node, -1 if empty
+	int hash_cap;
+	int cur;			// frame of the current function
+	int skipped;		// calls past PROF_DEPTH not pushed
+};
+
+static int sym_find(rv32i_prof* prof, uint32_t pc)
+{
+	int lo = 0, hi = prof->sym_num - 1, k = -1;
+	while (lo <= hi) {	// last symbol at or below pc
+		int mid = (lo + hi) / 2;
+		if (prof->syms[mid].addr <= pc) k = mid, lo = mid + 1;
+		else hi = mid - 1;
+	}
+	return (k >= 0 && pc - prof->syms[k].addr < prof->syms[k].size) ? k : -1;
+}
+
+static const char* sym_name(rv32i_prof* prof, int sym)
+{
+	return (sym >= 0) ? prof->syms[sym].name : "[unknown]";
+}
+
+static unsigned node_hash(int parent, int sym, int cap)
+{
+	return ((unsigned)parent * 2654435761u ^ (unsigned)(sym + 1) * 40503u) & (cap - 1);
+}
+
+static void node_rehash(rv32i_prof* prof)
+{
+	prof->hash_cap = prof->hash_cap ? prof->hash_cap * 2 : 1024;
+	prof->hash = (int*)realloc(prof->hash, prof->hash_cap * sizeof(int));
+	memset(prof->hash, -1, prof->hash_cap * sizeof(int));
+	for (int i = 1; i < prof->node_num; i++) {
+		unsigned h = node_hash(prof->node[i].parent, prof->node[i].sym, prof->hash_cap);
+		while (prof->hash[h] >= 0) h = (h + 1) & (prof->hash_cap - 1);
+		prof->hash[h] = i;
+	}
+}
+
+// frame sym called from frame parent
+static int node_child(rv32i_prof* prof, int parent, int sym)
+{
+	unsigned h = node_hash(parent, sym, prof->hash_cap);
+	int i;
+
+	while ((i = prof->hash[h]) >= 0) {
+		if (prof->node[i].parent == parent && prof->node[i].sym == sym) return i;
+		h = (h + 1) & (prof->hash_cap - 1);
+	}
+
+	if (prof->node_num == prof->node_cap) {
+		prof->node_cap *= 2;
+		prof->node = (struct prof_node*)realloc(prof->node, prof->node_cap * sizeof(struct prof_node));
+	}
+	i = prof->node_num++;
+	prof->node[i].parent = parent;
+	prof->node[i].sym = sym;
+	prof->node[i].depth = prof->node[parent].depth + 1;
+	prof->node[i].cycles = 0;
+	prof->hash[h] = i;
+	if (prof->node_num * 2 > prof->hash_cap) node_rehash(prof);
+	return i;
+}
+
+rv32i_prof* rv32i_prof_create(rv32i_core* core)
+{
+	rv32i_prof* prof = (rv32i_prof*)calloc(1, sizeof(rv32i_prof));
+
+	prof->core = core;
+	prof->pc = (struct prof_pc*)calloc(core->cfg.imem_depth, sizeof(struct prof_pc));
+	prof->node_cap = 256;
+	prof->node = (struct prof_node*)calloc(prof->node_cap, sizeof(struct prof_node));
+	prof->node[0].parent = -1;
+	prof->node[0].sym = -1;
+	prof->node_num = 1;
+	node_rehash(prof);
+
+	core->prof = prof;
+	return prof;
+}
+
+void rv32i_prof_destroy(rv32i_prof* prof)
+{
+	if (!prof) return;
+	if (prof->core->prof == prof) prof->core->prof = NULL;
+	for (int i = 0; i < prof->sym_num; i++) free(prof->syms[i].name);
+	free(prof->syms);
+	free(prof->node);
+	free(prof->hash);
+	free(prof->pc);
+	free(prof);
+}
+
+int rv32i_prof_load_symbols(rv32i_prof* prof, const char* elf_file)
+{
+	struct rv32i_sym* syms;
+	int n = rv32i_elf_symbols(elf_file, &syms);
+	if (n < 0) return n;
+
+	for (int i = 0; i < prof->sym_num; i++) free(prof->syms[i].name);
+	free(prof->syms);
+	prof->syms = syms;
+	prof->sym_num = n;
+	return n;
+}
+
+void rv32i_prof_restart(rv32i_prof* prof)
+{
+	prof->cur = 0;
+	prof->skipped = 0;
+}
+
+void rv32i_prof_charge(rv32i_prof* prof, uint32_t pc, enum rv32i_charge kind)
+{
+	prof->cycles++;
+	if (kind == CHARGE_IDLE || (pc >> 2) >= prof->core->cfg.imem_depth) {
+		prof->idle++;
+		return;
+	}
+
+	struct prof_pc* p = &prof->pc[pc >> 2];
+	p->cycles++;
+	if (kind == CHARGE_EXEC) p->count++;
+	else if (kind == CHARGE_STALL) p->stall++;
+	else p->flush++;
+
+	prof->node[node_child(prof, prof->cur, sym_find(prof, pc))].cycles++;
+}
+
+void rv32i_prof_commit(rv32i_prof* prof, uint32_t pc, uint32_t inst)
+{
+	uint8_t opcode = inst & 0x7f, rd = (inst >> 7) & 0x1f, rs1 = (inst >> 15) & 0x1f;
+	if (opcode != 0x6f && opcode != 0x67) return;
+
+	if (rd == 1 || rd == 5) {	// call
+		if (prof->node[prof->cur].depth < PROF_DEPTH) prof->cur = node_child(prof, prof->cur, sym_find(prof, pc));
+		else prof->skipped++;
+	}
+	else if (opcode == 0x67 && rd == 0 && (rs1 == 1 || rs1 == 5)) {	// return
+		if (prof->skipped) prof->skipped--;
+		else if (prof->cur) prof->cur = prof->node[prof->cur].parent;
+	}
+}
+
+struct prof_func {
+	int sym;
+	uint64_t count, cycles, stall, flush;
+};
+
+static int func_cmp(const void* a, const void* b)
+{
+	const struct prof_func* x = (const struct prof_func*)a;
+	const struct prof_func* y = (const struct prof_func*)b;
+	return (x->cycles < y->cycles) - (x->cycles > y->cycles);
+}
+
+struct prof_hot {
+	uint32_t idx;
+	uint64_t cycles;
+};
+
+static int hot_cmp(const void* a, const void* b)
+{
+	uint64_t x = ((const struct prof_hot*)a)->cycles, y = ((const struct prof_hot*)b)->cycles;
+	return (x < y) - (x > y);
+}
+
+void rv32i_prof_report(rv32i_prof* prof, FILE* fp, int top)
+{
+	uint32_t i, n = 0;
+	int k, f;
+	double total = prof->cycles ? (double)prof->cycles : 1;
+
+	fprintf(fp, "\n*** Profile: %llu cycles, %llu idle ***\n", (unsigned long long)prof->cycles, (unsigned long long)prof->idle);
+
+	// hottest pcs
+	struct prof_hot* hot = (struct prof_hot*)malloc(prof->core->cfg.imem_depth * sizeof(struct prof_hot));
+	for (i = 0; i < prof->core->cfg.imem_depth; i++) {
+		if (!prof->pc[i].cycles) continue;
+		hot[n].idx = i;
+		hot[n++].cycles = prof->pc[i].cycles;
+	}
+	qsort(hot, n, sizeof(struct prof_hot), hot_cmp);
+
+	fprintf(fp, "%-10s %12s %12s %7s %10s %10s  %-10s %s\n", "pc", "count", "cycles", "%", "stall", "flush", "inst", "function");
+	for (i = 0; i < n && (int)i < top; i++) {
+		uint32_t pc = hot[i].idx << 2, inst = prof->core->imem_data[hot[i].idx];
+		struct prof_pc* p = &prof->pc[hot[i].idx];
+		k = sym_find(prof, pc);
+		fprintf(fp, "%08X   %12llu %12llu %6.2f%% %10llu %10llu  %-10s %s", pc, (unsigned long long)p->count,
+			(unsigned long long)p->cycles, 100 * p->cycles / total, (unsigned long long)p->stall, (unsigned long long)p->flush,
+			rv32i_inst_name(inst), sym_name(prof, k));
+		if (k >= 0) fprintf(fp, "+0x%x", pc - prof->syms[k].addr);
+		fprintf(fp, "\n");
+	}
+	free(hot);
+
+	// functions (self cycles)
+	struct prof_func* func = (struct prof_func*)calloc(prof->sym_num + 1, sizeof(struct prof_func));
+	for (f = 0; f <= prof->sym_num; f++) func[f].sym = f - 1;
+	for (i = 0; i < prof->core->cfg.imem_depth; i++) {
+		if (!prof->pc[i].cycles) continue;
+		struct prof_func* fn = &func[sym_find(prof, i << 2) + 1];
+		fn->count += prof->pc[i].count;
+		fn->cycles += prof->pc[i].cycles;
+		fn->stall += prof->pc[i].stall;
+		fn->flush += prof->pc[i].flush;
+	}
+	qsort(func, prof->sym_num + 1, sizeof(struct prof_func), func_cmp);
+
+	fprintf(fp, "\n%12s %7s %12s %7s %10s %10s  %s\n", "cycles", "%", "insts", "CPI", "stall", "flush", "function");
+	for (f = 0; f <= prof->sym_num && f < top && func[f].cycles; f++) {
+		fprintf(fp, "%12llu %6.2f%% %12llu %7.3f %10llu %10llu  %s\n", (unsigned long long)func[f].cycles, 100 * func[f].cycles / total,
+			(unsigned long long)func[f].count, func[f].count ? (double)func[f].cycles / func[f].count : 0.0,
+			(unsigned long long)func[f].stall, (unsigned long long)func[f].flush, sym_name(prof, func[f].sym));
+	}
+	free(func);
+}
+
+// frames of node, outermost first
+static void folded_path(rv32i_prof* prof, FILE* fp, int node)
+{
+	if (node <= 0) return;
+	folded_path(prof, fp, prof->node[node].parent);
+	fprintf(fp, "%s;", sym_name(prof, prof->node[node].sym));
+}
+
+void rv32i_prof_folded(rv32i_prof* prof, FILE* fp)
+{
+	for (int i = 1; i < prof->node_num; i++) {
+		if (!prof->node[i].cycles) continue;
+		folded_path(prof, fp, prof->node[i].parent);
+		fprintf(fp, "%s %llu\n", sym_name(prof, prof->node[i].sym), (unsigned long long)prof->node[i].cycles);
+	}
+}
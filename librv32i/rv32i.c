@@ -0,0 +1,278 @@
+#include "rv32i.h"
+#include "decode_table.h"
+
+struct imem_output_t imem(struct imem_input_t imem_in)
+{
+	struct imem_output_t output = { 0 };
+	output.dout = imem_in.imem_data[imem_in.addr];
+	return output;
+}
+
+struct rf_output_t regfile(struct rf_input_t regfile_in)
+{
+	if (regfile_in.reg_write) regfile_in.rf_data[regfile_in.rd] = regfile_in.rd_din;
+
+	struct rf_output_t output = { 0 };
+	//output.rs1_dout = (regfile_in.rs1) ? regfile_in.rf_data[regfile_in.rs1] : 0;
+	//output.rs2_dout = (regfile_in.rs2) ? regfile_in.rf_data[regfile_in.rs2] : 0;
+
+	output.rs1_dout = (regfile_in.reg_write && regfile_in.rd && (regfile_in.rs1 == regfile_in.rd)) ? regfile_in.rd_din : ((regfile_in.rs1 != 0) ? regfile_in.rf_data[regfile_in.rs1] : 0);
+	output.rs2_dout = (regfile_in.reg_write && regfile_in.rd && (regfile_in.rs2 == regfile_in.rd)) ? regfile_in.rd_din : ((regfile_in.rs2 != 0) ? regfile_in.rf_data[regfile_in.rs2] : 0);
+
+	return output;
+}
+
+struct alu_output_t alu(struct alu_input_t alu_in)
+{
+	uint64_t tmp = 0;
+
+	switch (alu_in.alu_control)
+	{
+	case 0:
+		tmp = alu_in.in1 & alu_in.in2;
+		break;
+	case 1:
+		tmp = alu_in.in1 | alu_in.in2;
+		break;
+	case 2:
+		tmp = (uint64_t)alu_in.in1 + alu_in.in2;
+		break;
+	case 3:
+		tmp = alu_in.in1 ^ alu_in.in2;
+		break;
+	case 6:
+		tmp = (uint64_t)alu_in.in1 - alu_in.in2;
+		break;
+	case 7:
+		tmp = (uint64_t)alu_in.in1 << alu_in.in2;
+		break;
+	case 8:
+		tmp = alu_in.in1 >> alu_in.in2;
+		break;
+	case 9:
+		tmp = ((int64_t)alu_in.in1) >> alu_in.in2;
+		break;
+	// Zba/Zbb (isa/rvb.isa)
+	case 4:		//andn
+		tmp = alu_in.in1 & ~alu_in.in2;
+		break;
+	case 5:		//orn
+		tmp = (uint32_t)(alu_in.in1 | ~alu_in.in2);
+		break;
+	case 10:	//xnor
+		tmp = (uint32_t)~(alu_in.in1 ^ alu_in.in2);
+		break;
+	case 11:	//min
+		tmp = ((int32_t)alu_in.in1 < (int32_t)alu_in.in2) ? alu_in.in1 : alu_in.in2;
+		break;
+	case 12:	//max
+		tmp = ((int32_t)alu_in.in1 > (int32_t)alu_in.in2) ? alu_in.in1 : alu_in.in2;
+		break;
+	case 13:	//minu
+		tmp = (alu_in.in1 < alu_in.in2) ? alu_in.in1 : alu_in.in2;
+		break;
+	case 14:	//maxu
+		tmp = (alu_in.in1 > alu_in.in2) ? alu_in.in1 : alu_in.in2;
+		break;
+	case 15:	//rol
+		tmp = (uint32_t)((alu_in.in1 << (alu_in.in2 & 31)) | (alu_in.in1 >> (-alu_in.in2 & 31)));
+		break;
+	case 16:	//ror, rori
+		tmp = (uint32_t)((alu_in.in1 >> (alu_in.in2 & 31)) | (alu_in.in1 << (-alu_in.in2 & 31)));
+		break;
+	case 17:	//sh1add
+	case 18:	//sh2add
+	case 19:	//sh3add
+		tmp = (uint32_t)((alu_in.in1 << (alu_in.alu_control - 16)) + alu_in.in2);
+		break;
+	case 20:	//rev8
+		tmp = __builtin_bswap32(alu_in.in1);
+		break;
+	case 21:	//orc.b
+		for (int i = 0; i < 32; i += 8) {
+			if ((alu_in.in1 >> i) & 0xff) tmp |= 0xffu << i;
+		}
+		break;
+	case 22:	//zext.h
+		tmp = alu_in.in1 & 0xffff;
+		break;
+	case 23:	//clz, ctz, cpop, sext.b, sext.h by the rs2 field
+		switch (alu_in.in2 & 0x1f)
+		{
+		case 0: tmp = alu_in.in1 ? __builtin_clz(alu_in.in1) : 32; break;
+		case 1: tmp = alu_in.in1 ? __builtin_ctz(alu_in.in1) : 32; break;
+		case 2: tmp = __builtin_popcount(alu_in.in1); break;
+		case 4: tmp = (uint32_t)(int32_t)(int8_t)alu_in.in1; break;
+		case 5: tmp = (uint32_t)(int32_t)(int16_t)alu_in.in1; break;
+		default: break;
+		}
+		break;
+	default:
+		break;
+	}
+
+	struct alu_output_t output = { 0 };
+	output.result = tmp;
+	return output;
+}
+
+struct dmem_output_t dmem(struct dmem_input_t dmem_in)
+{
+
+	if (dmem_in.mem_write) {
+		dmem_in.dmem_data[dmem_in.addr] = dmem_in.din;
+	}
+
+	struct dmem_output_t output;
+	output.dout = dmem_in.mem_read ? dmem_in.dmem_data[dmem_in.addr] : 0;
+	return output;
+}
+
+struct decoder_output_t decoder(struct decoder_input_t decoder_in)
+{
+	struct decoder_output_t output = { 0 };
+	uint32_t inst = decoder_in.inst;
+	uint8_t opcode = inst & 0x7f;
+	uint8_t funct3 = (inst >> 12) & 0x7;
+	uint8_t funct7 = (inst >> 25) & 0x7f;
+
+	// generated tables (isa/rv32i.isa): {opcode, funct3} and funct7 where it selects the instruction
+	const struct decode_entry* e = &decode_table[DECODE_INDEX(inst)];
+	if (e->f7) e = &decode_f7_table[e->f7 - 1][funct7];
+
+	output.opcode = opcode;
+	output.funct3 = funct3;
+	output.funct7 = funct7;
+
+	for (int i = 0; i < 7; i++) output.branch[i] = (e->branch >> i) & 0x1;
+	output.alu_src = e->alu_src;
+	output.alu_op = e->alu_op;
+	output.alu_control = e->alu_control;
+	output.slt = e->slt;
+	output.mem_read = e->mem_read;
+	output.mem_write = e->mem_write;
+	output.mem_to_reg = e->mem_to_reg;
+	output.reg_write = e->reg_write;
+	output.trap = e->trap;
+	output.amo = e->amo;
+	output.vec = e->vec;
+
+	switch (e->imm)
+	{
+	case IMM_I:
+		output.imm32 = (uint32_t)((int32_t)inst >> 20);
+		break;
+	case IMM_S:
+		output.imm32 = (uint32_t)((int32_t)(inst & 0xfe000000) >> 20) | ((inst >> 7) & 0x1f);
+		break;
+	case IMM_B:	//offset >> 1
+		output.imm32 = (uint32_t)((int32_t)(inst & 0x80000000) >> 20) | (((inst >> 7) & 0x1) << 10) | (((inst >> 25) & 0x3f) << 4) | ((inst >> 8) & 0xf);
+		break;
+	case IMM_J:	//offset >> 1
+		output.imm32 = (uint32_t)((int32_t)(inst & 0x80000000) >> 12) | (((inst >> 12) & 0xff) << 11) | (((inst >> 20) & 0x1) << 10) | ((inst >> 21) & 0x3ff);
+		break;
+	case IMM_U:
+		output.imm32 = (uint32_t)((int32_t)inst >> 12);
+		break;
+	case IMM_SHAMT:
+		output.imm32 = (inst >> 20) & 0x1f;
+		break;
+	default:
+		break;
+	}
+
+	output.rs1 = e->rs1 ? (inst >> 15) & 0x1f : 0;
+	output.rs2 = e->rs2 ? (inst >> 20) & 0x1f : 0;
+	output.rd = (inst >> 7) & 0x1f;
+
+	return output;
+}
+
+struct exec_output_t execute(struct exec_input_t exec_in)
+{
+	struct decoder_output_t* ctrl = &exec_in.ctrl;
+	struct alu_input_t alu_in = { 0 };
+	struct alu_output_t alu_out = { 0 };
+
+	alu_in.in1 = ((ctrl->branch[6] && ctrl->opcode == 0x6f) || ctrl->opcode == 0x17) ? exec_in.pc : exec_in.rs1_dout;
+	if (ctrl->opcode == 0x17) alu_in.in2 = ctrl->imm32 << 12;	//auipc, imm32 is the upper immediate like lui's
+	else alu_in.in2 = ctrl->alu_src ? ctrl->imm32 : exec_in.rs2_dout;
+	alu_in.alu_control = ctrl->alu_control;
+	alu_out = alu(alu_in);
+
+	uint8_t zero = (alu_out.result == 0);
+	uint8_t sign = (alu_out.result >> 31) & 0x1;
+	uint8_t carry = (alu_out.result >> 32) & 0x1;
+
+	struct exec_output_t output = { 0 };
+	output.alu_result = alu_out.result;
+
+	if (ctrl->branch[0]) output.branch_taken = zero;	//beq
+	else if (ctrl->branch[1]) output.branch_taken = !zero;	//bne
+	else if (ctrl->branch[2]) output.branch_taken = sign;	//blt
+	else if (ctrl->branch[3]) output.branch_taken = (!sign || zero);	//bge
+	else if (ctrl->branch[4]) output.branch_taken = carry;	//bltu
+	else if (ctrl->branch[5]) output.branch_taken = (!carry || zero);	//bgeu
+	else if (ctrl->branch[6]) output.branch_taken = 1;	//jal, jalr
+
+	if (ctrl->opcode == 0x67) output.branch_target = output.alu_result;	//jalr
+	else output.branch_target = exec_in.pc + (ctrl->imm32 << 1);
+
+	if (ctrl->branch[6]) output.rd_din = exec_in.pc + 4;
+	else if (ctrl->slt) {
+		if (ctrl->opcode == 0x33 && ctrl->funct3 == 3 && ctrl->funct7 == 0) output.rd_din = carry;	//sltu
+		else output.rd_din = sign;
+	}
+	else if (ctrl->opcode == 0x37) output.rd_din = ctrl->imm32 << 12;	//lui
+	else output.rd_din = output.alu_result;
+
+	if (ctrl->funct3 == 0) output.dmem_din = exec_in.rs2_dout & 0xff;	//sb
+	else if (ctrl->funct3 == 1) output.dmem_din = exec_in.rs2_dout & 0xffff;	//sh
+	else output.dmem_din = exec_in.rs2_dout;	//sw
+
+	return output;
+}
+
+uint32_t load_data(uint8_t funct3, uint32_t dmem_dout)
+{
+	if (funct3 == 0) return (dmem_dout & 0x80) ? (0xffffff00 | (dmem_dout & 0xff)) : (dmem_dout & 0xff);	//lb
+	else if (funct3 == 1) return (dmem_dout & 0x8000) ? (0xffff0000 | (dmem_dout & 0xffff)) : (dmem_dout & 0xffff);	//lh
+	else if (funct3 == 4) return dmem_dout & 0xff;	//lbu
+	else if (funct3 == 5) return dmem_dout & 0xffff;	//lhu
+	return dmem_dout;	//lw
+}
+
+uint32_t amo_data(uint8_t amo, uint32_t dmem_dout, uint32_t rs2_dout)
+{
+	switch (amo)
+	{
+	case AMO_ADD:
+		return dmem_dout + rs2_dout;
+	case AMO_XOR:
+		return dmem_dout ^ rs2_dout;
+	case AMO_AND:
+		return dmem_dout & rs2_dout;
+	case AMO_OR:
+		return dmem_dout | rs2_dout;
+	case AMO_MIN:
+		return ((int32_t)dmem_dout < (int32_t)rs2_dout) ? dmem_dout : rs2_dout;
+	case AMO_MAX:
+		return ((int32_t)dmem_dout > (int32_t)rs2_dout) ? dmem_dout : rs2_dout;
+	case AMO_MINU:
+		return (dmem_dout < rs2_dout) ? dmem_dout : rs2_dout;
+	case AMO_MAXU:
+		return (dmem_dout > rs2_dout) ? dmem_dout : rs2_dout;
+	default:
+		return rs2_dout;	//amoswap, sc
+	}
+}
+
+void show_state(uint32_t* reg_data, uint32_t* dmem_data)
+{
+	int i;
+	puts("\nREGISTER FILE");
+	for (i = 0; i < 32; i++) printf("RF[%03d]: %08X\n", i, reg_data[i]);
+
+	puts("\nDMEM");
+	for (i = 0; i < 15; i++) printf("DMEM[%03d]: %08X\n", i, dmem_data[i]);
+}
\ No newline at end of file
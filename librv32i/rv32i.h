@@ -0,0 +1,341 @@
+/* **************************************
+ * Module: datapath elements of the rv32i models (librv32i)
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+ // headers
+#ifndef _RV32I_H_
+#define _RV32I_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+
+// defines
+#define REG_WIDTH 32
+#ifndef IMEM_DEPTH
+#define IMEM_DEPTH 1024	// words, default of rv32i_config
+#endif
+#ifndef DMEM_DEPTH
+#define DMEM_DEPTH 1024
+#endif
+
+// configs
+#define ISSUE_WIDTH 2	// dual-issue model: instructions fetched and issued per cycle
+#define ALU_NUM 2		// dual-issue model: ALUs in EX (1 turns ALU users into a structural hazard)
+
+// out-of-order model (override with -D)
+#ifndef ROB_SIZE
+#define ROB_SIZE 16		// reorder buffer entries
+#endif
+#ifndef RS_SIZE
+#define RS_SIZE 4		// entries in each functional unit's reservation station
+#endif
+#ifndef LSQ_SIZE
+#define LSQ_SIZE 8		// load/store queue entries
+#endif
+#define FQ_SIZE (2 * ISSUE_WIDTH)	// fetch queue entries
+
+// multi-hart model (override with -D)
+#ifndef SMP_QUANTUM
+#define SMP_QUANTUM 1000	// cycles a hart runs between synchronizations
+#endif
+
+// syscall proxy (override with -D)
+#ifndef SYS_CLOCK_HZ
+#define SYS_CLOCK_HZ 100000000	// simulated clock behind gettimeofday/times
+#endif
+#define SYS_CONSOLE_BUF 4096	// buffered console output
+#define SYS_FILE_NUM 16			// guest file descriptors
+
+// Zve32x vector unit of the single-cycle engine (rv32i_config.vlen)
+#define VLEN_MAX 256			// bits of a vector register
+#define VLENB_MAX (VLEN_MAX / 8)
+
+// gdb stub
+#define GDB_POINT_NUM 64		// breakpoints, and watchpoints
+#define GDB_CHUNK 65536			// cycles run between checks for an interrupt from gdb
+#define GDB_PACKET_MAX 4096
+
+// structures
+struct imem_input_t {
+	uint32_t addr;
+	uint32_t* imem_data;
+};
+
+struct imem_output_t {
+	uint32_t dout;
+};
+
+struct rf_input_t {
+	uint8_t rs1;	//source register 1
+	uint8_t rs2;	//source register 2
+	uint8_t rd;		//destination register
+	uint32_t rd_din;	//input data for rd
+	uint8_t reg_write;	//regwrite signal
+	uint32_t* rf_data;
+};
+
+struct rf_output_t {
+	uint32_t rs1_dout;
+	uint32_t rs2_dout;
+};
+
+struct alu_input_t {
+	uint32_t in1;	//Operand 1
+	uint32_t in2;	//Operand 2
+	uint8_t alu_control;	//ALU control signal
+};
+
+struct alu_output_t {
+	uint64_t result;	//ALU output
+};
+
+struct dmem_input_t {
+	uint32_t addr;
+	uint32_t din;
+	uint8_t mem_read;
+	uint8_t mem_write;
+	uint32_t* dmem_data;
+};
+
+struct dmem_output_t {
+	uint32_t dout;
+};
+
+struct decoder_input_t {
+	uint32_t inst;
+};
+
+struct decoder_output_t {
+	uint8_t opcode;
+	uint8_t funct3;
+	uint8_t funct7;
+	uint8_t rs1;		//0 if the instruction doesn't read rs1
+	uint8_t rs2;		//0 if the instruction doesn't read rs2
+	uint8_t rd;
+	uint32_t imm32;
+	uint8_t branch[7];
+	uint8_t alu_src;
+	uint8_t alu_op;
+	uint8_t alu_control;
+	uint8_t slt;
+	uint8_t mem_read;
+	uint8_t mem_write;
+	uint8_t mem_to_reg;
+	uint8_t reg_write;
+	uint8_t trap;		//ecall (imm32 0) or ebreak (imm32 1)
+	uint8_t amo;		//A extension: enum amo_op_t, AMO_NONE for the other instructions
+	uint8_t vec;		//Zve32x: enum vec_op_t, VEC_NONE for the scalar instructions
+};
+
+struct exec_input_t {
+	uint32_t pc;
+	uint32_t rs1_dout;	//forwarded operands
+	uint32_t rs2_dout;
+	struct decoder_output_t ctrl;
+};
+
+struct exec_output_t {
+	uint32_t alu_result;	//address for ld/sd
+	uint32_t rd_din;		//result for rd (except ld)
+	uint32_t dmem_din;		//data for sd
+	uint8_t branch_taken;
+	uint32_t branch_target;
+};
+
+// macro-op fusion: adjacent pairs the pipeline engine runs as one instruction
+enum fuse_t {
+	FUSE_NONE = 0,
+	FUSE_LUI_ADDI,		//lui rd + addi rd, rd: 32-bit constant
+	FUSE_AUIPC_JALR,	//auipc rd + jalr rd, rd: far call or jump
+	FUSE_AUIPC_LW,		//auipc rd + lw rd, rd: pc-relative load
+	FUSE_AUIPC_SW,		//auipc rd + sw rs2, rd: pc-relative store, rd still gets pc + upper immediate
+	FUSE_SLLI_SRLI,		//slli rd, rs1, n + srli rd, rd, n: zero-extension, an and with a mask
+	FUSE_NUM
+};
+
+// Pipe reg: IF/ID
+typedef struct {
+	uint32_t pc;
+	uint32_t inst;
+	uint32_t inst2;		//second word of the pair when fuse isn't FUSE_NONE
+	uint8_t fuse;		//enum fuse_t
+	uint8_t valid;		//model only: holds an instruction, not a bubble
+	uint8_t blame;		//model only: a bubble's cycle is charged to blame_pc (enum rv32i_charge)
+	uint32_t blame_pc;
+	uint32_t seq;		//model only: instruction number for the viewer log, 0 for a bubble
+} pipe_if_id;
+
+// Pipe reg: ID/EX
+typedef struct {
+	uint32_t pc;
+	uint32_t rs1_dout;
+	uint32_t rs2_dout;
+	uint32_t imm32;
+	uint8_t opcode;
+	uint8_t funct3;
+	uint8_t funct7;
+	uint8_t branch[7];
+	uint8_t alu_src;
+	uint8_t alu_op;
+	uint8_t alu_control;
+	uint8_t slt;
+	uint8_t mem_read;
+	uint8_t mem_write;
+	uint8_t rs1;
+	uint8_t rs2;
+	uint8_t rd;         // rd for regfile
+	uint8_t reg_write;
+	uint8_t mem_to_reg;
+	uint8_t fuse;		//enum fuse_t: pc is the first of the pair
+	uint32_t fuse_din;	//the result of the first of the pair (lui, auipc)
+	uint8_t valid;		//model only
+	uint8_t blame;
+	uint32_t blame_pc;
+	uint32_t seq;
+} pipe_id_ex;
+
+// Pipe reg: EX/MEM
+typedef struct {
+	uint32_t alu_result; // for address
+	uint32_t rs2_dout;   // for store
+	uint8_t mem_read;
+	uint8_t mem_write;
+	uint8_t rd;
+	uint8_t reg_write;
+	uint8_t mem_to_reg;
+	uint8_t funct3;
+	uint8_t opcode;
+	uint8_t slt;
+	uint32_t imm32;
+	uint32_t pc;
+	uint8_t sign;
+	uint8_t carry;
+	uint8_t ub;
+	uint8_t fuse;
+	uint32_t fuse_din;
+	uint8_t valid;		//model only
+	uint8_t taken;		//model only: branches resolved in MEM
+	uint32_t target;	//model only
+	uint8_t blame;
+	uint32_t blame_pc;
+	uint32_t seq;
+} pipe_ex_mem;
+
+// Pipe reg: MEM/WB
+typedef struct {
+	uint32_t alu_result;
+	uint32_t dmem_dout;
+	uint8_t rd;
+	uint8_t reg_write;
+	uint8_t mem_to_reg;
+	uint8_t funct3;
+	uint8_t opcode;
+	uint8_t slt;
+	uint32_t imm32;
+	uint32_t pc;
+	uint8_t sign;
+	uint8_t carry;
+	uint8_t ub;
+	uint8_t fuse;
+	uint32_t fuse_din;
+	uint8_t valid;		//model only
+	uint8_t blame;
+	uint32_t blame_pc;
+	uint32_t seq;
+} pipe_mem_wb;
+
+// Lane regs for the dual-issue model (one entry per issue slot, lane 0 is the older)
+typedef struct {
+	uint8_t valid;
+	uint32_t pc;
+	uint32_t inst;
+} lane_if_id;
+
+typedef struct {
+	uint8_t valid;
+	uint32_t pc;
+	uint32_t rs1_dout;
+	uint32_t rs2_dout;
+	struct decoder_output_t ctrl;
+} lane_id_ex;
+
+typedef struct {
+	uint8_t valid;
+	uint32_t pc;
+	uint32_t alu_result;	//address for ld/sd
+	uint32_t rd_din;
+	uint32_t dmem_din;
+	uint8_t mem_read;
+	uint8_t mem_write;
+	uint8_t funct3;
+	uint8_t rd;
+	uint8_t reg_write;
+} lane_ex_mem;
+
+typedef struct {
+	uint8_t valid;
+	uint32_t pc;
+	uint32_t rd_din;
+	uint8_t rd;
+	uint8_t reg_write;
+} lane_mem_wb;
+
+// Out-of-order model entries
+typedef struct {
+	uint8_t ready;
+	uint8_t tag;		//rob index of the producer while !ready
+	uint32_t value;
+} ooo_operand;
+
+typedef struct {
+	uint8_t valid;
+	uint8_t done;
+	uint64_t seq;		//program order
+	uint32_t pc;
+	struct decoder_output_t ctrl;
+	uint32_t rd_din;
+	uint8_t mispredict;
+	uint32_t branch_target;
+	uint8_t lsq;		//lsq index for ld/sd
+} rob_entry;
+
+typedef struct {
+	uint8_t valid;
+	uint8_t rob;
+	uint64_t seq;
+	uint32_t pc;
+	struct decoder_output_t ctrl;
+	ooo_operand src1;
+	ooo_operand src2;
+} rs_entry;
+
+typedef struct {
+	uint8_t valid;
+	uint8_t rob;
+	uint64_t seq;
+	uint8_t store;
+	uint8_t funct3;
+	uint8_t addr_ready;
+	uint32_t addr;
+	uint8_t issued;		//load has been sent to dmem
+	ooo_operand data;	//store data
+} lsq_entry;
+
+struct imem_output_t imem(struct imem_input_t imem_in);
+struct rf_output_t regfile(struct rf_input_t regfile_in);
+struct alu_output_t alu(struct alu_input_t alu_in);
+struct dmem_output_t dmem(struct dmem_input_t dmem_in);
+struct decoder_output_t decoder(struct decoder_input_t decoder_in);
+struct exec_output_t execute(struct exec_input_t exec_in);
+uint32_t load_data(uint8_t funct3, uint32_t dmem_dout);
+uint32_t amo_data(uint8_t amo, uint32_t dmem_dout, uint32_t rs2_dout);
+
+void show_state(uint32_t* reg_data, uint32_t* dmem_data);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,242 @@
+/* **************************************
+ * Module: librv32i internals shared by the engines
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#ifndef _RV32I_CORE_H_
+#define _RV32I_CORE_H_
+
+#include "rv32i.h"
+#include "librv32i.h"
+#include "decode_table.h"
+#include <pthread.h>
+
+// host time of the engines (hostprof.c): the hot loop marks the part it enters, the
+// time stamp counter (or clock_gettime) ticks since the last mark go to the part left,
+// rv32i_step/rv32i_run_until calibrate ticks against clock_gettime once per call
+enum rv32i_host_part {
+	HOST_OTHER = 0,		// the loop, pipeline register copies, viewer log
+	HOST_FETCH,
+	HOST_DECODE,		// decoder and regfile read
+	HOST_EXEC,
+	HOST_MEM,
+	HOST_WB,
+	HOST_HAZARD,		// hazard detection and forwarding units
+	HOST_IO,			// trace output and the commit/memory/ecall callbacks (the syscall proxy)
+	HOST_PART_NUM
+};
+
+// an engine is a clocked model of the processor operating on the core's state
+struct rv32i_engine_ops {
+	const char* name;
+	size_t state_size;
+	void (*reset)(rv32i_core* core);		// clear the engine state (state is zeroed before)
+	void (*cycle)(rv32i_core* core);		// advance one clock
+	uint32_t (*pc)(rv32i_core* core);		// pc of the next instruction to fetch
+	int (*report)(rv32i_core* core, FILE* fp);	// optional
+	void (*destroy)(rv32i_core* core);		// optional
+};
+
+// lr/sc reservation of a hart
+struct rv32i_resv {
+	uint8_t valid;
+	uint32_t idx;			// reserved dmem word
+	uint32_t value;			// word seen by lr, sc fails if it changed
+};
+
+// Zve32x state (vector.c), LMUL 1 only
+struct rv32i_vec {
+	uint8_t v[32][VLENB_MAX];	// the low vlen/8 bytes are used
+	uint32_t vl;
+	uint32_t vtype;			// VTYPE_ILL after an unsupported vsetvli, until the next
+};
+
+#define VTYPE_ILL 0x80000000u
+
+struct rv32i_core {
+	enum rv32i_engine engine;
+	const struct rv32i_engine_ops* ops;
+	void* state;			// engine state
+	struct rv32i_config cfg;
+
+	// architectural state
+	uint32_t* reg_data;
+	uint32_t* imem_data;
+	uint32_t* dmem_data;
+	uint32_t* dmem_image;	// dmem contents restored on reset
+
+	uint64_t cycle;			// cycles since reset
+	uint64_t retired;		// instructions retired since reset
+	uint8_t halted;			// stops rv32i_step/rv32i_run_until until the next reset
+	uint8_t ebreak;			// the halt was an ebreak at ebreak_pc
+	uint32_t ebreak_pc;
+	uint64_t charged[4];	// cycles per enum rv32i_charge since reset
+	uint64_t fused;			// instruction pairs retired as one since reset (pipeline engine)
+
+	// set by the loaders
+	uint32_t entry;			// pc after reset
+	uint32_t stack;			// x2 after reset, 0 leaves it 0
+	uint32_t heap;			// first free dmem byte after the image
+
+	struct rv32i_resv resv;
+	struct rv32i_vec vec;
+	rv32i_smp* smp;			// system sharing dmem with this hart, NULL for a lone core
+	int hart;
+
+	rv32i_commit_cb commit_cb;
+	void* commit_arg;
+	rv32i_mem_cb mem_cb;
+	void* mem_arg;
+	rv32i_ecall_cb ecall_cb;
+	void* ecall_arg;
+	rv32i_prof* prof;		// guest profiler, NULL if off
+	rv32i_view* view;		// pipeline viewer log, NULL if off
+	rv32i_undo* undo;		// undo log, NULL if off
+	FILE* trace;
+
+	// host time of the engine per enum rv32i_host_part since reset (hostprof.c, built with -DHOST_PROF)
+	uint8_t host_on;		// inside rv32i_step/rv32i_run_until
+	uint8_t host_part;		// part the ticks since host_last go to
+	uint64_t host_last;
+	uint64_t host_ticks[HOST_PART_NUM];
+	uint64_t host_ns;		// time spent inside rv32i_step/rv32i_run_until, clock_gettime nanoseconds
+	uint64_t host_start_ns;
+};
+
+// harts of a multi-hart system share imem/dmem of hart 0 (rv32i_smp_*)
+struct rv32i_smp {
+	int harts;
+	rv32i_core** hart;
+	uint64_t quantum;		// cycles a hart runs between synchronizations
+	int deterministic;		// run the harts round-robin on the calling thread
+
+	pthread_mutex_t resv_lock;	// serializes lr/sc and reservation snooping
+	int resv_count;			// valid reservations, snooping is skipped while 0
+
+	// parallel run
+	pthread_barrier_t barrier;
+	uint64_t max_cycles;
+	uint64_t cycles;		// cycles run by every hart
+	int stop;
+};
+
+// ELF symbol (elf.c)
+struct rv32i_sym {
+	uint32_t addr;
+	uint32_t size;
+	uint8_t func;
+	char* name;
+};
+
+int rv32i_elf_symbols(const char* path, struct rv32i_sym** syms);	// sorted by address, returns count or RV32I_ERR_*
+
+// what a cycle is charged to (profile.c)
+enum rv32i_charge {
+	CHARGE_EXEC = 0,	// the instruction completing this cycle
+	CHARGE_STALL,		// bubble of a stall caused by the instruction (load-use, ecall drain)
+	CHARGE_FLUSH,		// bubble of a flush caused by the instruction (taken branch)
+	CHARGE_IDLE			// bubble nobody caused (pipeline fill)
+};
+
+void rv32i_prof_charge(rv32i_prof* prof, uint32_t pc, enum rv32i_charge kind);
+void rv32i_prof_commit(rv32i_prof* prof, uint32_t pc, uint32_t inst);
+void rv32i_prof_restart(rv32i_prof* prof);
+
+#ifdef HOST_PROF
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define rv32i_host_now() __rdtsc()
+#else
+uint64_t rv32i_host_now(void);	// clock_gettime nanoseconds
+#endif
+
+// returns the part left
+static inline int rv32i_host_mark(rv32i_core* core, int part)
+{
+	int prev = core->host_part;
+	if (core->host_on) {
+		uint64_t now = rv32i_host_now();
+		core->host_ticks[prev] += now - core->host_last;
+		core->host_last = now;
+	}
+	core->host_part = part;
+	return prev;
+}
+
+void rv32i_host_start(rv32i_core* core);
+void rv32i_host_stop(rv32i_core* core);
+#define HOST_MARK(core, part) ((void)rv32i_host_mark(core, part))
+#define HOST_ENTER(core, part) rv32i_host_mark(core, part)
+#define HOST_LEAVE(core, prev) ((void)rv32i_host_mark(core, prev))
+#define HOST_START(core) rv32i_host_start(core)
+#define HOST_STOP(core) rv32i_host_stop(core)
+#else
+#define HOST_MARK(core, part) ((void)0)
+#define HOST_ENTER(core, part) 0
+#define HOST_LEAVE(core, prev) ((void)(prev))
+#define HOST_START(core) ((void)0)
+#define HOST_STOP(core) ((void)0)
+#endif
+
+// pipeline viewer log (pipeview.c): each cycle the engine reports the instruction
+// in every stage, seq is a number it gives the instruction at fetch, 0 for a bubble
+#define VIEW_STAGES 5	// F D X M W
+void rv32i_view_stage(rv32i_view* view, int stage, uint32_t seq, uint32_t pc);
+void rv32i_view_cycle(rv32i_view* view);	// after the stages of the cycle
+void rv32i_view_restart(rv32i_view* view);
+
+// undo log (undo.c): the old value of what is about to be written, the engine's
+// writes belong to the cycle, the others (rv32i_set_reg, ...) are edits
+void rv32i_undo_reg(rv32i_undo* undo, int reg);
+void rv32i_undo_mem(rv32i_undo* undo, uint32_t idx);	// dmem word
+void rv32i_undo_vec(rv32i_undo* undo, int vreg);	// vreg, vl and vtype
+void rv32i_undo_resv(rv32i_undo* undo);
+void rv32i_undo_pc(rv32i_undo* undo, uint32_t pc);	// rv32i_core_restart, an edit
+void rv32i_undo_edit(rv32i_undo* undo);	// the record before was an edit
+void rv32i_undo_ecall(rv32i_undo* undo, int done);	// around the ecall handler
+void rv32i_undo_cycle(rv32i_undo* undo);	// after each cycle
+void rv32i_undo_restart(rv32i_undo* undo);
+
+extern const struct rv32i_engine_ops rv32i_single_ops;
+extern const struct rv32i_engine_ops rv32i_pipeline_ops;
+extern const struct rv32i_engine_ops rv32i_dual_ops;
+extern const struct rv32i_engine_ops rv32i_ooo_ops;
+void rv32i_pipeline_shuffle(rv32i_core* core, uint32_t seed);	// tests: latch the stages in a random order, seed != 0
+
+// called by the engines
+void rv32i_core_commit(rv32i_core* core, uint32_t pc, uint8_t rd, uint8_t reg_write, uint32_t rd_din);
+void rv32i_core_mem(rv32i_core* core, uint32_t pc, uint32_t addr, uint32_t data, uint8_t write);
+uint32_t rv32i_core_amo(rv32i_core* core, uint32_t pc, uint32_t addr, uint32_t rs2_dout, uint8_t amo);	// returns rd
+void rv32i_core_snoop(rv32i_core* core, uint32_t addr);	// a store of core hit addr
+uint32_t rv32i_core_vec(rv32i_core* core, uint32_t pc, uint32_t inst, uint8_t vec, uint32_t rs1_dout);	// returns rd
+uint32_t rv32i_core_load_lanes(rv32i_core* core, uint32_t addr, int size);	// rv32i_config.byte_lanes dmem
+void rv32i_core_store_lanes(rv32i_core* core, uint32_t addr, int size, uint32_t value);
+void rv32i_core_trap(rv32i_core* core, uint32_t pc, uint32_t imm32);	// ecall/ebreak, older instructions are done
+void rv32i_core_restart(rv32i_core* core, uint32_t pc);	// drop the instructions in flight and fetch from pc (gdb stub)
+
+// byte lanes: the bytes a load/store of funct3 accesses, and whether they cross a word at addr
+#define LANES_SIZE(funct3) (((funct3) & 3) == 0 ? 1 : ((funct3) & 3) == 1 ? 2 : 4)
+#define LANES_CROSS(addr, size) (((addr) & 3) + (size) > 4)
+
+// the engines without the vector unit (all but single) run its instructions as nops
+#define VEC_NOP(ctrl) do { if ((ctrl).vec) (ctrl).mem_read = (ctrl).mem_write = (ctrl).reg_write = 0; } while (0)
+
+// mnemonic of an instruction word
+static inline const char* rv32i_inst_name(uint32_t inst)
+{
+	const struct decode_entry* e = &decode_table[DECODE_INDEX(inst)];
+	if (e->f7) e = &decode_f7_table[e->f7 - 1][inst >> 25];
+	return e->name ? e->name : "?";
+}
+
+// once per cycle, before the cycle's commit
+static inline void rv32i_core_charge(rv32i_core* core, uint32_t pc, enum rv32i_charge kind)
+{
+	core->charged[kind]++;
+	if (core->prof) rv32i_prof_charge(core->prof, pc, kind);
+}
+
+#endif
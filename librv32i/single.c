@@ -0,0 +1,107 @@
+/* **************************************
+ * Module: single-cycle engine
+ *
+ * - One instruction per cycle, the reference for the other engines
+ * - Executes the A extension (the only engine that does, see smp.c) and,
+ *   with rv32i_config.vlen, the Zve32x subset of isa/rvv.isa (vector.c)
+ * - Hands the old value of every write to the undo log when one is
+ *   attached (undo.c), the only engine that can run backwards
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+
+struct single_state {
+	uint32_t pc_curr;	// program counter
+};
+
+static void single_reset(rv32i_core* core)
+{
+	((struct single_state*)core->state)->pc_curr = core->entry;
+}
+
+static void single_cycle(rv32i_core* core)
+{
+	struct single_state* s = (struct single_state*)core->state;
+
+	// instruction fetch
+	HOST_MARK(core, HOST_FETCH);
+	struct imem_input_t imem_in = { s->pc_curr >> 2, core->imem_data };
+	uint32_t inst = (imem_in.addr < core->cfg.imem_depth) ? imem(imem_in).dout : 0;	// past the end of imem: a nop
+
+	// instruction decode
+	HOST_MARK(core, HOST_DECODE);
+	struct decoder_input_t decoder_in = { inst };
+	struct decoder_output_t ctrl = decoder(decoder_in);
+
+	struct rf_input_t regfile_in = { 0 };
+	regfile_in.rf_data = core->reg_data;
+	regfile_in.rs1 = (inst >> 15) & 0x1f;
+	regfile_in.rs2 = (inst >> 20) & 0x1f;
+	regfile_in.rd = ctrl.rd;
+	regfile_in.reg_write = 0;	//not now (bc it is just decode step!)
+	struct rf_output_t regfile_out = regfile(regfile_in);
+
+	// execution
+	HOST_MARK(core, HOST_EXEC);
+	struct exec_input_t exec_in = { s->pc_curr, regfile_out.rs1_dout, regfile_out.rs2_dout, ctrl };
+	struct exec_output_t exec_out = execute(exec_in);
+
+	uint32_t pc = s->pc_curr;
+	s->pc_curr = exec_out.branch_taken ? exec_out.branch_target : pc + 4;
+
+	// memory
+	HOST_MARK(core, HOST_MEM);
+	struct dmem_input_t dmem_in = { 0 };
+	dmem_in.dmem_data = core->dmem_data;
+	dmem_in.addr = exec_out.alu_result >> 2; //32bit-dmem
+	dmem_in.din = exec_out.dmem_din;
+	dmem_in.mem_read = ctrl.mem_read && dmem_in.addr < core->cfg.dmem_depth;	// outside dmem: reads 0, writes are dropped
+	dmem_in.mem_write = ctrl.mem_write && dmem_in.addr < core->cfg.dmem_depth;
+	struct dmem_output_t dmem_out = { 0 };
+	uint32_t vec_rd = 0;
+	if (ctrl.vec) {
+		if (core->undo && core->cfg.vlen) rv32i_undo_vec(core->undo, (inst >> 7) & 0x1f);
+		if (core->cfg.vlen) vec_rd = rv32i_core_vec(core, pc, inst, ctrl.vec, regfile_out.rs1_dout);
+		else ctrl.reg_write = 0;	// no vector unit: a nop
+	}
+	else if (ctrl.amo) dmem_out.dout = rv32i_core_amo(core, pc, exec_out.alu_result, regfile_out.rs2_dout, ctrl.amo);
+	else {
+		if (core->undo && dmem_in.mem_write && !core->cfg.byte_lanes) rv32i_undo_mem(core->undo, dmem_in.addr);
+		if (!core->cfg.byte_lanes) dmem_out = dmem(dmem_in);
+		else if (ctrl.mem_write) rv32i_core_store_lanes(core, exec_out.alu_result, LANES_SIZE(ctrl.funct3), dmem_in.din);
+		else if (ctrl.mem_read) dmem_out.dout = rv32i_core_load_lanes(core, exec_out.alu_result, LANES_SIZE(ctrl.funct3));
+		if (ctrl.mem_read || ctrl.mem_write) rv32i_core_mem(core, pc, exec_out.alu_result, ctrl.mem_write ? dmem_in.din : dmem_out.dout, ctrl.mem_write);
+		if (ctrl.mem_write) rv32i_core_snoop(core, exec_out.alu_result);
+		if (ctrl.mem_write && core->cfg.byte_lanes && LANES_CROSS(exec_out.alu_result, LANES_SIZE(ctrl.funct3))) rv32i_core_snoop(core, exec_out.alu_result + 4);
+	}
+
+	// write-back
+	HOST_MARK(core, HOST_WB);
+	regfile_in.reg_write = ctrl.reg_write;
+	regfile_in.rd_din = ctrl.vec ? vec_rd : ctrl.mem_to_reg ? load_data(ctrl.funct3, dmem_out.dout) : exec_out.rd_din;
+	if (core->undo && ctrl.reg_write) rv32i_undo_reg(core->undo, ctrl.rd);
+	regfile(regfile_in);
+	if (ctrl.trap) rv32i_core_trap(core, pc, ctrl.imm32);
+	rv32i_core_charge(core, pc, CHARGE_EXEC);
+	rv32i_core_commit(core, pc, ctrl.rd, ctrl.reg_write, regfile_in.rd_din);
+	HOST_MARK(core, HOST_OTHER);
+}
+
+static uint32_t single_pc(rv32i_core* core)
+{
+	return ((struct single_state*)core->state)->pc_curr;
+}
+
+const struct rv32i_engine_ops rv32i_single_ops = {
+	"single",
+	sizeof(struct single_state),
+	single_reset,
+	single_cycle,
+	single_pc,
+	NULL,
+	NULL,
+};
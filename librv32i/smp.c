@@ -0,0 +1,185 @@
+/* **************************************
+ * Module: multi-hart system
+ *
+ * - N single-cycle harts sharing imem and dmem (the arrays of hart 0)
+ * - One host thread per hart, the harts meet at a barrier every quantum
+ *   so no hart runs more than a quantum ahead of the others
+ * - Deterministic mode runs the harts round-robin on the calling thread
+ * - lr/sc/amo* are executed by rv32i_core_amo() (core.c)
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+#include <string.h>
+
+struct hart_thread {
+	rv32i_smp* smp;
+	int hart;
+	pthread_t thread;
+};
+
+rv32i_smp* rv32i_smp_create(int harts)
+{
+	if (harts < 1) return NULL;
+
+	rv32i_smp* smp = (rv32i_smp*)calloc(1, sizeof(rv32i_smp));
+	smp->harts = harts;
+	smp->hart = (rv32i_core**)calloc(harts, sizeof(rv32i_core*));
+	smp->quantum = SMP_QUANTUM;
+	pthread_mutex_init(&smp->resv_lock, NULL);
+
+	for (int h = 0; h < harts; h++) {
+		rv32i_core* core = rv32i_create(RV32I_SINGLE);
+		core->smp = smp;
+		core->hart = h;
+		if (h) {	// memories of hart 0
+			free(core->imem_data);
+			free(core->dmem_data);
+			free(core->dmem_image);
+			core->imem_data = smp->hart[0]->imem_data;
+			core->dmem_data = smp->hart[0]->dmem_data;
+			core->dmem_image = smp->hart[0]->dmem_image;
+		}
+		smp->hart[h] = core;
+	}
+
+	rv32i_smp_reset(smp);
+	return smp;
+}
+
+void rv32i_smp_destroy(rv32i_smp* smp)
+{
+	if (!smp) return;
+	for (int h = smp->harts - 1; h >= 0; h--) {
+		if (h) smp->hart[h]->imem_data = smp->hart[h]->dmem_data = smp->hart[h]->dmem_image = NULL;
+		rv32i_destroy(smp->hart[h]);
+	}
+	pthread_mutex_destroy(&smp->resv_lock);
+	free(smp->hart);
+	free(smp);
+}
+
+int rv32i_smp_load_image(rv32i_smp* smp, const char* imem_file, const char* dmem_file)
+{
+	int ret = rv32i_load_image(smp->hart[0], imem_file, dmem_file);
+	rv32i_smp_reset(smp);
+	return ret;
+}
+
+void rv32i_smp_reset(rv32i_smp* smp)
+{
+	for (int h = 0; h < smp->harts; h++) {
+		rv32i_reset(smp->hart[h]);
+		rv32i_set_reg(smp->hart[h], 10, h);	// a0 = hart id
+	}
+	smp->resv_count = 0;
+}
+
+void rv32i_smp_set_quantum(rv32i_smp* smp, uint64_t cycles)
+{
+	smp->quantum = cycles ? cycles : 1;
+}
+
+void rv32i_smp_set_deterministic(rv32i_smp* smp, int on)
+{
+	smp->deterministic = on;
+}
+
+int rv32i_smp_harts(rv32i_smp* smp)
+{
+	return smp->harts;
+}
+
+rv32i_core* rv32i_smp_hart(rv32i_smp* smp, int hart)
+{
+	return (hart >= 0 && hart < smp->harts) ? smp->hart[hart] : NULL;
+}
+
+int rv32i_smp_halted(rv32i_smp* smp, int hart)
+{
+	return (hart >= 0 && hart < smp->harts) ? smp->hart[hart]->halted : 1;
+}
+
+// run a hart for up to n cycles, returns 0 once it has halted
+static int hart_run(rv32i_smp* smp, int h, uint64_t n)
+{
+	rv32i_core* core = smp->hart[h];
+	if (core->halted) return 0;
+
+	for (uint64_t i = 0; i < n; i++) {
+		uint32_t pc = core->ops->pc(core);
+		if ((pc >> 2) >= core->cfg.imem_depth) {	// ran off the program
+			core->halted = 1;
+			return 0;
+		}
+		core->ops->cycle(core);
+		core->cycle++;
+		if (core->ops->pc(core) == pc) core->halted = 1;	// jump to itself
+		if (core->halted) return 0;
+	}
+	return 1;
+}
+
+static void* hart_thread(void* arg)
+{
+	struct hart_thread* t = (struct hart_thread*)arg;
+	rv32i_smp* smp = t->smp;
+
+	while (!smp->stop) {
+		uint64_t n = smp->max_cycles - smp->cycles;
+		if (n > smp->quantum) n = smp->quantum;
+		hart_run(smp, t->hart, n);
+
+		// the last hart to arrive decides whether to go on, the second wait publishes it
+		if (pthread_barrier_wait(&smp->barrier) == PTHREAD_BARRIER_SERIAL_THREAD) {
+			int running = 0;
+			for (int h = 0; h < smp->harts; h++) running |= !smp->hart[h]->halted;
+			smp->cycles += n;
+			smp->stop = !running || smp->cycles >= smp->max_cycles;
+		}
+		pthread_barrier_wait(&smp->barrier);
+	}
+	return NULL;
+}
+
+uint64_t rv32i_smp_run(rv32i_smp* smp, uint64_t max_cycles)
+{
+	uint64_t retired = 0;
+	int h;
+
+	for (h = 0; h < smp->harts; h++) retired -= smp->hart[h]->retired;
+
+	smp->max_cycles = max_cycles;
+	smp->cycles = 0;
+	smp->stop = (max_cycles == 0);
+
+	if (smp->deterministic || smp->harts == 1) {
+		while (!smp->stop) {
+			uint64_t n = smp->max_cycles - smp->cycles;
+			int running = 0;
+			if (n > smp->quantum) n = smp->quantum;
+			for (h = 0; h < smp->harts; h++) running |= hart_run(smp, h, n);
+			smp->cycles += n;
+			smp->stop = !running || smp->cycles >= smp->max_cycles;
+		}
+	}
+	else {	// hart 0 runs on the calling thread
+		struct hart_thread* t = (struct hart_thread*)calloc(smp->harts, sizeof(struct hart_thread));
+		pthread_barrier_init(&smp->barrier, NULL, smp->harts);
+		for (h = 0; h < smp->harts; h++) {
+			t[h].smp = smp;
+			t[h].hart = h;
+			if (h) pthread_create(&t[h].thread, NULL, hart_thread, &t[h]);
+		}
+		hart_thread(&t[0]);
+		for (h = 1; h < smp->harts; h++) pthread_join(t[h].thread, NULL);
+		pthread_barrier_destroy(&smp->barrier);
+		free(t);
+	}
+
+	for (h = 0; h < smp->harts; h++) retired += smp->hart[h]->retired;
+	return retired;
+}
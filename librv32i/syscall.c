@@ -0,0 +1,382 @@
+/* **************************************
+ * Module: newlib syscall proxy
+ *
+ * - ecall handler for programs linked against newlib/libgloss (riscv):
+ *   a7 = call number, a0-a3 = arguments, a0 = result or -errno
+ * - Console output (fd 1, 2) is buffered and flushed when full, before
+ *   reading stdin and on exit
+ * - Files are opened relative to a sandbox directory one component at a
+ *   time: absolute paths, ".." and symbolic links are refused
+ * - Host errors are returned as newlib errno values
+ * - Time is the simulated cycle count at SYS_CLOCK_HZ
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+// libgloss call numbers
+enum {
+	SYS_openat = 56,
+	SYS_close = 57,
+	SYS_lseek = 62,
+	SYS_read = 63,
+	SYS_write = 64,
+	SYS_fstat = 80,
+	SYS_exit = 93,
+	SYS_exit_group = 94,
+	SYS_times = 153,
+	SYS_gettimeofday = 169,
+	SYS_brk = 214,
+	SYS_open = 1024
+};
+
+// newlib errno values, 1 to GUEST_ERANGE are the same on Linux and the BSDs
+#define GUEST_EIO		5
+#define GUEST_EBADF		9
+#define GUEST_EACCES	13
+#define GUEST_EFAULT	14
+#define GUEST_EINVAL	22
+#define GUEST_EMFILE	24
+#define GUEST_ESPIPE	29
+#define GUEST_ERANGE	34
+#define GUEST_ENOSYS	88
+#define GUEST_ENOTEMPTY	90
+#define GUEST_ENAMETOOLONG	91
+#define GUEST_ELOOP		92
+#define GUEST_EOVERFLOW	139
+
+// newlib open flags
+#define GUEST_O_ACCMODE	0x0003
+#define GUEST_O_APPEND	0x0008
+#define GUEST_O_CREAT	0x0200
+#define GUEST_O_TRUNC	0x0400
+#define GUEST_O_EXCL	0x0800
+
+#define GUEST_AT_FDCWD	-100
+#define GUEST_CLOCKS_PER_SEC 1000	// newlib's clock() unit for times()
+
+struct rv32i_sys {
+	rv32i_core* core;
+	FILE* console;
+	char buf[SYS_CONSOLE_BUF];
+	size_t len;
+	int dir;				// sandbox directory, -1 if files can't be opened
+	int fd[SYS_FILE_NUM];	// host fd of each guest fd, -1 if closed
+	uint32_t brk;
+	int exited;
+	int code;
+	uint64_t unknown;
+};
+
+// guest memory is dmem, byte addressed little-endian
+static int guest_range(rv32i_core* core, uint32_t addr, uint32_t len)
+{
+	return (uint64_t)addr + len <= (uint64_t)core->cfg.dmem_depth * 4;
+}
+
+static uint8_t guest_rd8(rv32i_core* core, uint32_t addr)
+{
+	return core->dmem_data[addr >> 2] >> ((addr & 0x3) << 3);
+}
+
+static void guest_wr8(rv32i_core* core, uint32_t addr, uint8_t b)
+{
+	uint32_t shift = (addr & 0x3) << 3;
+	if (core->undo) rv32i_undo_mem(core->undo, addr >> 2);
+	core->dmem_data[addr >> 2] = (core->dmem_data[addr >> 2] & ~(0xffu << shift)) | ((uint32_t)b << shift);
+}
+
+static void guest_wr32(rv32i_core* core, uint32_t addr, uint32_t w)
+{
+	for (int i = 0; i < 4; i++) guest_wr8(core, addr + i, w >> (i << 3));
+}
+
+static void guest_rd(rv32i_core* core, uint32_t addr, void* dst, uint32_t len)
+{
+	for (uint32_t i = 0; i < len; i++) ((uint8_t*)dst)[i] = guest_rd8(core, addr + i);
+}
+
+static void guest_wr(rv32i_core* core, uint32_t addr, const void* src, uint32_t len)
+{
+	for (uint32_t i = 0; i < len; i++) guest_wr8(core, addr + i, ((const uint8_t*)src)[i]);
+}
+
+// NUL-terminated guest string, 0 if it doesn't fit
+static int guest_str(rv32i_core* core, uint32_t addr, char* dst, size_t size)
+{
+	for (size_t i = 0; i < size; i++) {
+		if (!guest_range(core, addr + i, 1)) return 0;
+		if ((dst[i] = guest_rd8(core, addr + i)) == '\0') return 1;
+	}
+	return 0;
+}
+
+void rv32i_sys_flush(rv32i_sys* sys)
+{
+	if (sys->len) fwrite(sys->buf, 1, sys->len, sys->console);
+	fflush(sys->console);
+	sys->len = 0;
+}
+
+// -errno of the guest for the host's errno e
+static int32_t guest_errno(int e)
+{
+	switch (e) {
+	case ENOSYS: return -GUEST_ENOSYS;
+	case ENOTEMPTY: return -GUEST_ENOTEMPTY;
+	case ENAMETOOLONG: return -GUEST_ENAMETOOLONG;
+	case ELOOP: return -GUEST_ELOOP;
+	case EOVERFLOW: return -GUEST_EOVERFLOW;
+	}
+	return (e > 0 && e <= GUEST_ERANGE) ? -e : -GUEST_EIO;
+}
+
+static int32_t sys_write(rv32i_sys* sys, uint32_t fd, uint32_t addr, uint32_t len)
+{
+	rv32i_core* core = sys->core;
+	char chunk[SYS_CONSOLE_BUF];
+	uint32_t done = 0;
+
+	if (fd >= SYS_FILE_NUM || sys->fd[fd] < 0 || fd == 0) return -GUEST_EBADF;
+	if (!guest_range(core, addr, len)) return -GUEST_EFAULT;
+
+	while (done < len) {
+		uint32_t n = (len - done < SYS_CONSOLE_BUF) ? len - done : SYS_CONSOLE_BUF;
+		if (fd <= 2) {	// console
+			if (sys->len + n > SYS_CONSOLE_BUF) rv32i_sys_flush(sys);
+			guest_rd(core, addr + done, sys->buf + sys->len, n);
+			sys->len += n;
+		}
+		else {
+			guest_rd(core, addr + done, chunk, n);
+			ssize_t w = write(sys->fd[fd], chunk, n);
+			if (w < 0) return done ? (int32_t)done : guest_errno(errno);
+			if ((uint32_t)w < n) return done + w;
+		}
+		done += n;
+	}
+	return done;
+}
+
+static int32_t sys_read(rv32i_sys* sys, uint32_t fd, uint32_t addr, uint32_t len)
+{
+	char chunk[SYS_CONSOLE_BUF];
+
+	if (fd >= SYS_FILE_NUM || sys->fd[fd] < 0 || fd == 1 || fd == 2) return -GUEST_EBADF;
+	if (!guest_range(sys->core, addr, len)) return -GUEST_EFAULT;
+	if (fd == 0) rv32i_sys_flush(sys);	// prompts before input
+
+	if (len > SYS_CONSOLE_BUF) len = SYS_CONSOLE_BUF;	// short read
+	ssize_t n = read(sys->fd[fd], chunk, len);
+	if (n < 0) return guest_errno(errno);
+	guest_wr(sys->core, addr, chunk, n);
+	return n;
+}
+
+// openat(dir, path) without leaving dir: every directory on the way is opened
+// O_NOFOLLOW, so a symbolic link anywhere in path fails with ELOOP or ENOTDIR
+static int open_beneath(int dir, char* path, int flags, mode_t mode)
+{
+	int at = dir, fd;
+	char* name = path;
+
+	for (char* slash; (slash = strchr(name, '/')) != NULL; name = slash + 1) {
+		*slash = '\0';
+		if (name[0] == '\0' || strcmp(name, ".") == 0) continue;
+		fd = openat(at, name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW);
+		if (at != dir) {
+			int e = errno;
+			close(at);
+			errno = e;
+		}
+		if (fd < 0) return -1;
+		at = fd;
+	}
+	if (name[0] == '\0') name = ".";	// "dir/": the directory itself
+	fd = openat(at, name, flags | O_NOFOLLOW, mode);
+	if (at != dir) {
+		int e = errno;
+		close(at);
+		errno = e;
+	}
+	return fd;
+}
+
+static int32_t sys_open(rv32i_sys* sys, uint32_t path_addr, uint32_t flags, uint32_t mode)
+{
+	char path[256];
+	int fd, host_flags;
+
+	if (!guest_str(sys->core, path_addr, path, sizeof(path))) return -GUEST_EFAULT;
+	if (sys->dir < 0 || path[0] == '/' || path[0] == '\0') return -GUEST_EACCES;
+	for (char* p = path; (p = strstr(p, "..")) != NULL; p += 2) {	// ".." components
+		if ((p == path || p[-1] == '/') && (p[2] == '/' || p[2] == '\0')) return -GUEST_EACCES;
+	}
+
+	for (fd = 3; fd < SYS_FILE_NUM && sys->fd[fd] >= 0; fd++);
+	if (fd == SYS_FILE_NUM) return -GUEST_EMFILE;
+
+	switch (flags & GUEST_O_ACCMODE) {
+	case 0: host_flags = O_RDONLY; break;
+	case 1: host_flags = O_WRONLY; break;
+	case 2: host_flags = O_RDWR; break;
+	default: return -GUEST_EINVAL;
+	}
+	if (flags & GUEST_O_APPEND) host_flags |= O_APPEND;
+	if (flags & GUEST_O_CREAT) host_flags |= O_CREAT;
+	if (flags & GUEST_O_TRUNC) host_flags |= O_TRUNC;
+	if (flags & GUEST_O_EXCL) host_flags |= O_EXCL;
+
+	if ((sys->fd[fd] = open_beneath(sys->dir, path, host_flags, mode & 0777)) < 0) return guest_errno(errno);
+	return fd;
+}
+
+static int32_t sys_close(rv32i_sys* sys, uint32_t fd)
+{
+	if (fd >= SYS_FILE_NUM || sys->fd[fd] < 0) return -GUEST_EBADF;
+	if (fd <= 2) return 0;	// the console stays open
+	close(sys->fd[fd]);
+	sys->fd[fd] = -1;
+	return 0;
+}
+
+static int32_t sys_lseek(rv32i_sys* sys, uint32_t fd, int32_t offset, uint32_t whence)
+{
+	if (fd >= SYS_FILE_NUM || sys->fd[fd] < 0) return -GUEST_EBADF;
+	if (fd <= 2) return -GUEST_ESPIPE;
+	off_t pos = lseek(sys->fd[fd], offset, whence);
+	if (pos < 0) return guest_errno(errno);
+	return (pos > INT32_MAX) ? -GUEST_EOVERFLOW : (int32_t)pos;
+}
+
+// struct kernel_stat of libgloss: st_mode at 16, st_size at 48, st_blksize at 56, 128 bytes
+static int32_t sys_fstat(rv32i_sys* sys, uint32_t fd, uint32_t addr)
+{
+	struct stat st;
+	uint32_t mode = 0020000, size = 0;	// S_IFCHR: the console is a tty to newlib
+
+	if (fd >= SYS_FILE_NUM || sys->fd[fd] < 0) return -GUEST_EBADF;
+	if (!guest_range(sys->core, addr, 128)) return -GUEST_EFAULT;
+	if (fd > 2) {
+		if (fstat(sys->fd[fd], &st) < 0) return guest_errno(errno);
+		mode = st.st_mode;
+		size = st.st_size;
+	}
+	for (int i = 0; i < 128; i += 4) guest_wr32(sys->core, addr + i, 0);
+	guest_wr32(sys->core, addr + 16, mode);
+	guest_wr32(sys->core, addr + 48, size);
+	guest_wr32(sys->core, addr + 56, 512);
+	return 0;
+}
+
+static int32_t sys_brk(rv32i_sys* sys, uint32_t addr)
+{
+	if (sys->brk < sys->core->heap) sys->brk = sys->core->heap;	// loaded after rv32i_sys_create()
+	if (addr >= sys->core->heap && addr <= sys->core->reg_data[2]) sys->brk = addr;	// below the stack
+	return sys->brk;
+}
+
+static int32_t sys_gettimeofday(rv32i_sys* sys, uint32_t addr)
+{
+	uint64_t cycle = sys->core->cycle;
+	uint64_t sec = cycle / SYS_CLOCK_HZ;
+	uint32_t usec = (uint32_t)((cycle % SYS_CLOCK_HZ) * 1000000 / SYS_CLOCK_HZ);
+
+	if (!addr) return 0;
+	if (!guest_range(sys->core, addr, 12)) return -GUEST_EFAULT;
+	guest_wr32(sys->core, addr, (uint32_t)sec);	// 64-bit time_t
+	guest_wr32(sys->core, addr + 4, (uint32_t)(sec >> 32));
+	guest_wr32(sys->core, addr + 8, usec);
+	return 0;
+}
+
+static int32_t sys_times(rv32i_sys* sys, uint32_t addr)
+{
+	uint32_t ticks = (uint32_t)(sys->core->cycle / (SYS_CLOCK_HZ / GUEST_CLOCKS_PER_SEC));
+
+	if (addr) {	// tms_utime, tms_stime, tms_cutime, tms_cstime
+		if (!guest_range(sys->core, addr, 16)) return -GUEST_EFAULT;
+		guest_wr32(sys->core, addr, ticks);
+		for (int i = 4; i < 16; i += 4) guest_wr32(sys->core, addr + i, 0);
+	}
+	return ticks;
+}
+
+static void sys_ecall(void* arg, rv32i_core* core, uint32_t pc)
+{
+	rv32i_sys* sys = (rv32i_sys*)arg;
+	uint32_t* x = core->reg_data;
+	int32_t ret;
+	(void)pc;
+
+	switch (x[17]) {	// a7
+	case SYS_write: ret = sys_write(sys, x[10], x[11], x[12]); break;
+	case SYS_read: ret = sys_read(sys, x[10], x[11], x[12]); break;
+	case SYS_open: ret = sys_open(sys, x[10], x[11], x[12]); break;
+	case SYS_openat: ret = ((int32_t)x[10] == GUEST_AT_FDCWD) ? sys_open(sys, x[11], x[12], x[13]) : -GUEST_EBADF; break;
+	case SYS_close: ret = sys_close(sys, x[10]); break;
+	case SYS_lseek: ret = sys_lseek(sys, x[10], x[11], x[12]); break;
+	case SYS_fstat: ret = sys_fstat(sys, x[10], x[11]); break;
+	case SYS_brk: ret = sys_brk(sys, x[10]); break;
+	case SYS_gettimeofday: ret = sys_gettimeofday(sys, x[10]); break;
+	case SYS_times: ret = sys_times(sys, x[10]); break;
+	case SYS_exit:
+	case SYS_exit_group:
+		sys->exited = 1;
+		sys->code = x[10];
+		rv32i_sys_flush(sys);
+		rv32i_halt(core);
+		return;
+	default:
+		sys->unknown++;
+		ret = -GUEST_ENOSYS;
+		break;
+	}
+	x[10] = ret;
+}
+
+rv32i_sys* rv32i_sys_create(rv32i_core* core, const char* sandbox_dir, FILE* console)
+{
+	rv32i_sys* sys = (rv32i_sys*)calloc(1, sizeof(rv32i_sys));
+	int i;
+
+	sys->core = core;
+	sys->console = console ? console : stdout;
+	sys->dir = sandbox_dir ? open(sandbox_dir, O_RDONLY | O_DIRECTORY) : -1;
+	for (i = 0; i < SYS_FILE_NUM; i++) sys->fd[i] = (i <= 2) ? i : -1;
+	sys->brk = core->heap;
+
+	rv32i_set_ecall_cb(core, sys_ecall, sys);
+	return sys;
+}
+
+void rv32i_sys_destroy(rv32i_sys* sys)
+{
+	if (!sys) return;
+	rv32i_sys_flush(sys);
+	for (int i = 3; i < SYS_FILE_NUM; i++) {
+		if (sys->fd[i] >= 0) close(sys->fd[i]);
+	}
+	if (sys->dir >= 0) close(sys->dir);
+	if (sys->core->ecall_arg == sys) rv32i_set_ecall_cb(sys->core, NULL, NULL);
+	free(sys);
+}
+
+int rv32i_sys_exited(rv32i_sys* sys, int* code)
+{
+	if (sys->exited && code) *code = sys->code;
+	return sys->exited;
+}
+
+uint64_t rv32i_sys_unknown(rv32i_sys* sys)
+{
+	return sys->unknown;
+}
@@ -0,0 +1,494 @@
+/* **************************************
+ * Module: undo log (reverse execution of the single-cycle engine)
+ *
+ * - Before a write the engine hands over the old value (a register, a dmem
+ *   word, a vector register, the lr/sc reservation), after each cycle a
+ *   cycle record closes the frame: 5-10 bytes an instruction, the pc only
+ *   when it didn't advance by 4
+ * - Records are written to a ring of a fixed size, payload first and the tag
+ *   byte last, so the log is read backwards; when the ring is full the oldest
+ *   quarter of the frames is dropped
+ * - Every interval cycles a checkpoint copies the registers and dmem; when
+ *   the checkpoints run out every other one is dropped and the interval
+ *   doubles, so they reach back to the reset in bounded memory
+ * - Going back within the log pops frames, going further restores the
+ *   nearest checkpoint and runs forward from it, which calls the ecall
+ *   handler again (the console output of the program repeats)
+ * - The ecall handler's writes (registers, the proxy's guest memory) belong
+ *   to the ecall's frame; rv32i_set_reg, rv32i_write_mem of dmem and
+ *   rv32i_core_restart between runs are edits, undone with the frame before
+ *   them; imem, the ecall handler's own state, the profiler and the viewer
+ *   aren't rolled back
+ * - A lone single-cycle hart only (the other engines keep instructions in
+ *   flight, harts share dmem)
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+#include <string.h>
+
+#define CKPT_NUM 32
+#define CKPT_INTERVAL 100000	// cycles between checkpoints when none is given
+#define LOG_MIN 4096
+
+// record types, the tag is type | arg << 3
+enum { T_CYCLE = 0, T_REG, T_MEM, T_PC, T_RESV, T_VEC, T_EDIT };	// T_EDIT: the record before is an edit
+#define CYC_JUMP 1		// T_CYCLE arg: the old pc follows, it isn't pc - 4
+#define CYC_RETIRED 2	// T_CYCLE arg: the cycle retired an instruction
+
+#define NOT_FOUND ~0ull
+
+struct undo_ckpt {
+	uint64_t cycle;
+	uint64_t retired;
+	uint64_t exec;			// charged[CHARGE_EXEC]
+	uint32_t pc;
+	uint8_t halted;
+	uint8_t ebreak;
+	uint32_t ebreak_pc;
+	uint32_t reg[32];
+	struct rv32i_resv resv;
+	uint32_t* dmem;
+	struct rv32i_vec* vec;	// NULL without a vector unit
+};
+
+struct rv32i_undo {
+	rv32i_core* core;
+	uint8_t* log;
+	uint64_t mask;			// ring size - 1
+	uint64_t head;			// bytes ever written, the ring position is & mask
+	uint64_t tail;			// the oldest record kept, always the start of a frame
+	uint64_t first;			// cycle of the state at tail
+	int cut;				// a frame didn't fit: the log restarts after it
+	uint32_t vlenb;
+
+	uint32_t pc;			// pc after the last frame or edit
+	uint64_t retired;		// core->retired after the last frame
+	uint64_t last_pos;		// head after the last T_MEM, ~0 if another record followed
+	uint32_t last_idx;
+	uint32_t ecall_reg[32];	// registers before the ecall handler
+
+	struct undo_ckpt ckpt[CKPT_NUM];
+	int ckpts;
+	uint64_t interval;
+	uint64_t interval0;
+
+	// stops searched while replaying from a checkpoint (rv32i_undo_reverse)
+	const struct rv32i_undo_stop* stop;
+	int stops;
+	int hit;				// stop hit by a write of the current frame, -1 if none
+	uint64_t found;			// cycle of the last frame hitting a stop
+	int found_stop;
+};
+
+static inline uint8_t log_byte(rv32i_undo* undo, uint64_t pos)
+{
+	return undo->log[pos & undo->mask];
+}
+
+static uint32_t log_word(rv32i_undo* undo, uint64_t pos)
+{
+	uint32_t w = 0;
+	for (int i = 0; i < 4; i++) w |= (uint32_t)log_byte(undo, pos + i) << (8 * i);
+	return w;
+}
+
+static void put(rv32i_undo* undo, const void* data, size_t len)
+{
+	const uint8_t* b = (const uint8_t*)data;
+	for (size_t i = 0; i < len; i++) undo->log[undo->head++ & undo->mask] = b[i];
+}
+
+static void put_word(rv32i_undo* undo, uint32_t w)
+{
+	put(undo, &w, 4);	// the hosts are little-endian like the guest
+}
+
+static uint64_t rec_size(rv32i_undo* undo, uint8_t tag)
+{
+	switch (tag & 7) {
+	case T_REG:
+	case T_PC: return 5;
+	case T_MEM: return 9;
+	case T_RESV: return 10;
+	case T_VEC: return 9 + undo->vlenb;
+	case T_EDIT: return 1;
+	default: return 1 + (((tag >> 3) & CYC_JUMP) ? 4 : 0);
+	}
+}
+
+/* room for a record of size bytes: drops the oldest frames until the log is
+ * at most 3/4 full with it; if the frames in progress don't even fit, the log
+ * is cut and restarts after the current frame
+ */
+static void reserve(rv32i_undo* undo, uint64_t size)
+{
+	uint64_t room = undo->mask + 1;
+	if (undo->head - undo->tail + size <= room) return;
+
+	uint64_t keep = room - room / 4, pos = undo->head, tail = 0;
+	int frames = 0, kept = -1;
+	while (!undo->cut && pos > undo->tail && undo->head - pos + size <= keep) {
+		uint8_t tag = log_byte(undo, pos - 1);
+		if ((tag & 7) == T_CYCLE) {	// pos is the end of a frame
+			tail = pos;
+			kept = frames++;
+		}
+		pos -= rec_size(undo, tag);
+	}
+	if (kept < 0) {
+		undo->cut = 1;
+		undo->tail = undo->head;
+		return;
+	}
+	undo->tail = tail;
+	undo->first = undo->core->cycle - kept;
+}
+
+static void end_record(rv32i_undo* undo, uint8_t type, uint8_t arg)
+{
+	uint8_t tag = type | arg << 3;
+	put(undo, &tag, 1);
+}
+
+static int write_stop(const struct rv32i_undo_stop* stop, int n, uint32_t idx)
+{
+	uint32_t word = idx << 2;
+	for (int i = 0; i < n; i++) {
+		if (stop[i].write && word < stop[i].addr + stop[i].len && word + 4 > stop[i].addr) return i;
+	}
+	return -1;
+}
+
+static int pc_stop(const struct rv32i_undo_stop* stop, int n, uint32_t pc)
+{
+	for (int i = 0; i < n; i++) {
+		if (!stop[i].write && stop[i].addr == pc) return i;
+	}
+	return -1;
+}
+
+static void log_reg(rv32i_undo* undo, int reg, uint32_t old)
+{
+	reserve(undo, 5);
+	put_word(undo, old);
+	end_record(undo, T_REG, reg);
+}
+
+void rv32i_undo_reg(rv32i_undo* undo, int reg)
+{
+	if (reg > 0 && reg < 32) log_reg(undo, reg, undo->core->reg_data[reg]);
+}
+
+void rv32i_undo_mem(rv32i_undo* undo, uint32_t idx)
+{
+	rv32i_core* core = undo->core;
+	if (idx >= core->cfg.dmem_depth) return;
+	if (undo->stop && undo->hit < 0) undo->hit = write_stop(undo->stop, undo->stops, idx);
+	if (undo->last_pos == undo->head && undo->last_idx == idx) return;	// the same word again: keep the older value
+
+	reserve(undo, 9);
+	put_word(undo, idx);
+	put_word(undo, core->dmem_data[idx]);
+	end_record(undo, T_MEM, 0);
+	undo->last_pos = undo->head;
+	undo->last_idx = idx;
+}
+
+void rv32i_undo_vec(rv32i_undo* undo, int vreg)
+{
+	struct rv32i_vec* v = &undo->core->vec;
+	reserve(undo, 9 + undo->vlenb);
+	put(undo, v->v[vreg], undo->vlenb);
+	put_word(undo, v->vl);
+	put_word(undo, v->vtype);
+	end_record(undo, T_VEC, vreg);
+}
+
+void rv32i_undo_resv(rv32i_undo* undo)
+{
+	struct rv32i_resv* r = &undo->core->resv;
+	reserve(undo, 10);
+	put(undo, &r->valid, 1);
+	put_word(undo, r->idx);
+	put_word(undo, r->value);
+	end_record(undo, T_RESV, 0);
+}
+
+void rv32i_undo_pc(rv32i_undo* undo, uint32_t pc)
+{
+	reserve(undo, 5);
+	put_word(undo, undo->pc);
+	end_record(undo, T_PC, 0);
+	undo->pc = pc;
+	rv32i_undo_edit(undo);
+}
+
+void rv32i_undo_edit(rv32i_undo* undo)
+{
+	reserve(undo, 1);
+	end_record(undo, T_EDIT, 0);
+}
+
+void rv32i_undo_ecall(rv32i_undo* undo, int done)
+{
+	uint32_t* x = undo->core->reg_data;
+	if (!done) {
+		memcpy(undo->ecall_reg, x, sizeof(undo->ecall_reg));
+		return;
+	}
+	for (int i = 1; i < 32; i++) {	// the handler wrote them directly, log the ones it changed
+		if (x[i] != undo->ecall_reg[i]) log_reg(undo, i, undo->ecall_reg[i]);
+	}
+}
+
+// the pc of the single-cycle engine, without logging it as an edit
+static void set_pc(rv32i_undo* undo, uint32_t pc)
+{
+	rv32i_core* core = undo->core;
+	core->undo = NULL;
+	rv32i_core_restart(core, pc);
+	core->undo = undo;
+	undo->pc = pc;
+}
+
+static void ckpt_take(rv32i_undo* undo)
+{
+	rv32i_core* core = undo->core;
+
+	if (undo->ckpts == CKPT_NUM) {	// full: keep every other one, twice as far apart
+		int n = 1;
+		undo->interval *= 2;
+		for (int i = 1; i < undo->ckpts; i++) {
+			if (undo->ckpt[i].cycle % undo->interval) continue;
+			struct undo_ckpt t = undo->ckpt[n];
+			undo->ckpt[n++] = undo->ckpt[i];
+			undo->ckpt[i] = t;
+		}
+		undo->ckpts = n;
+		if (core->cycle % undo->interval) return;
+	}
+
+	struct undo_ckpt* c = &undo->ckpt[undo->ckpts++];
+	if (!c->dmem) c->dmem = (uint32_t*)malloc(core->cfg.dmem_depth * sizeof(uint32_t));
+	if (!c->vec && core->cfg.vlen) c->vec = (struct rv32i_vec*)malloc(sizeof(struct rv32i_vec));
+	c->cycle = core->cycle;
+	c->retired = core->retired;
+	c->exec = core->charged[CHARGE_EXEC];
+	c->pc = undo->pc;
+	c->halted = core->halted;
+	c->ebreak = core->ebreak;
+	c->ebreak_pc = core->ebreak_pc;
+	memcpy(c->reg, core->reg_data, sizeof(c->reg));
+	c->resv = core->resv;
+	memcpy(c->dmem, core->dmem_data, core->cfg.dmem_depth * sizeof(uint32_t));
+	if (c->vec) *c->vec = core->vec;
+}
+
+// back to checkpoint k, the later ones and the log are dropped
+static void ckpt_restore(rv32i_undo* undo, int k)
+{
+	rv32i_core* core = undo->core;
+	const struct undo_ckpt* c = &undo->ckpt[k];
+
+	memcpy(core->reg_data, c->reg, sizeof(c->reg));
+	core->resv = c->resv;
+	memcpy(core->dmem_data, c->dmem, core->cfg.dmem_depth * sizeof(uint32_t));
+	if (c->vec) core->vec = *c->vec;
+	set_pc(undo, c->pc);
+	core->cycle = c->cycle;
+	core->retired = c->retired;
+	core->charged[CHARGE_EXEC] = c->exec;
+	core->halted = c->halted;
+	core->ebreak = c->ebreak;
+	core->ebreak_pc = c->ebreak_pc;
+
+	undo->ckpts = k + 1;
+	undo->retired = core->retired;
+	undo->tail = undo->head;
+	undo->first = core->cycle;
+	undo->cut = 0;
+	undo->last_pos = ~0ull;
+}
+
+void rv32i_undo_cycle(rv32i_undo* undo)
+{
+	rv32i_core* core = undo->core;
+	uint32_t pc = core->ops->pc(core);
+	uint8_t arg = (core->retired != undo->retired) ? CYC_RETIRED : 0;
+
+	if (pc != undo->pc + 4) arg |= CYC_JUMP;
+	reserve(undo, (arg & CYC_JUMP) ? 5 : 1);
+	if (arg & CYC_JUMP) put_word(undo, undo->pc);
+	end_record(undo, T_CYCLE, arg);
+
+	if (undo->stop) {
+		int hit = (undo->hit >= 0) ? undo->hit : pc_stop(undo->stop, undo->stops, undo->pc);
+		if (hit >= 0) {
+			undo->found = core->cycle - 1;
+			undo->found_stop = hit;
+		}
+		undo->hit = -1;
+	}
+	undo->pc = pc;
+	undo->retired = core->retired;
+	if (undo->cut) {	// the frames before this one are gone
+		undo->cut = 0;
+		undo->tail = undo->head;
+		undo->first = core->cycle;
+	}
+	if (core->cycle % undo->interval == 0) ckpt_take(undo);
+}
+
+// pops the newest record and writes its old value back, returns its tag
+static uint8_t pop(rv32i_undo* undo)
+{
+	rv32i_core* core = undo->core;
+	uint8_t tag = log_byte(undo, undo->head - 1);
+	uint64_t at = undo->head - rec_size(undo, tag);
+
+	switch (tag & 7) {
+	case T_REG:
+		core->reg_data[tag >> 3] = log_word(undo, at);
+		break;
+	case T_MEM:
+		core->dmem_data[log_word(undo, at)] = log_word(undo, at + 4);
+		break;
+	case T_PC:
+		set_pc(undo, log_word(undo, at));
+		break;
+	case T_RESV:
+		core->resv.valid = log_byte(undo, at);
+		core->resv.idx = log_word(undo, at + 1);
+		core->resv.value = log_word(undo, at + 5);
+		break;
+	case T_VEC:
+		for (uint32_t i = 0; i < undo->vlenb; i++) core->vec.v[tag >> 3][i] = log_byte(undo, at + i);
+		core->vec.vl = log_word(undo, at + undo->vlenb);
+		core->vec.vtype = log_word(undo, at + undo->vlenb + 4);
+		break;
+	case T_EDIT:
+		break;
+	default:	// T_CYCLE, clears halted: the cycle only ran because the core wasn't
+		core->cycle--;
+		if ((tag >> 3) & CYC_RETIRED) core->retired--;
+		core->charged[CHARGE_EXEC]--;
+		set_pc(undo, ((tag >> 3) & CYC_JUMP) ? log_word(undo, at) : undo->pc - 4);
+		undo->retired = core->retired;
+		break;
+	}
+	undo->head = at;
+	undo->last_pos = ~0ull;
+	return tag;
+}
+
+// undoes the edits since the last cycle and the cycle, returns the stop it hit or -1
+static int pop_frame(rv32i_undo* undo, const struct rv32i_undo_stop* stop, int n)
+{
+	int hit = -1;
+	uint8_t type;
+	while ((pop(undo) & 7) != T_CYCLE);
+	while (undo->head > undo->tail && (type = log_byte(undo, undo->head - 1) & 7) != T_CYCLE && type != T_EDIT) {
+		if (type == T_MEM && hit < 0) hit = write_stop(stop, n, log_word(undo, undo->head - 9));
+		pop(undo);
+	}
+	return (hit >= 0) ? hit : pc_stop(stop, n, undo->pc);
+}
+
+void rv32i_undo_restart(rv32i_undo* undo)
+{
+	rv32i_core* core = undo->core;
+	undo->tail = undo->head;
+	undo->first = core->cycle;
+	undo->cut = 0;
+	undo->last_pos = ~0ull;
+	undo->pc = core->ops->pc(core);
+	undo->retired = core->retired;
+	undo->ckpts = 0;
+	undo->interval = undo->interval0;
+	ckpt_take(undo);
+}
+
+rv32i_undo* rv32i_undo_create(rv32i_core* core, uint32_t log_bytes, uint64_t interval)
+{
+	if (core->engine != RV32I_SINGLE || core->smp) return NULL;
+
+	rv32i_undo* undo = (rv32i_undo*)calloc(1, sizeof(rv32i_undo));
+	uint64_t size = LOG_MIN;
+	while (size < log_bytes) size <<= 1;
+	undo->core = core;
+	undo->log = (uint8_t*)malloc(size);
+	undo->mask = size - 1;
+	undo->vlenb = core->cfg.vlen / 8;
+	undo->interval0 = interval ? interval : CKPT_INTERVAL;
+	undo->hit = -1;
+	rv32i_undo_restart(undo);
+
+	core->undo = undo;
+	return undo;
+}
+
+void rv32i_undo_destroy(rv32i_undo* undo)
+{
+	if (!undo) return;
+	if (undo->core->undo == undo) undo->core->undo = NULL;
+	for (int i = 0; i < CKPT_NUM; i++) {
+		free(undo->ckpt[i].dmem);
+		free(undo->ckpt[i].vec);
+	}
+	free(undo->log);
+	free(undo);
+}
+
+uint64_t rv32i_undo_first(rv32i_undo* undo)
+{
+	return undo->ckpt[0].cycle;
+}
+
+uint64_t rv32i_undo_goto(rv32i_undo* undo, uint64_t cycle)
+{
+	rv32i_core* core = undo->core;
+
+	if (cycle < undo->ckpt[0].cycle) cycle = undo->ckpt[0].cycle;
+	if (cycle < undo->first || undo->cut) {	// before the log: replay from the checkpoint before cycle
+		int k = undo->ckpts - 1;
+		while (undo->ckpt[k].cycle > cycle) k--;
+		ckpt_restore(undo, k);
+	}
+	while (core->cycle > cycle) pop_frame(undo, NULL, 0);
+	if (core->cycle < cycle) rv32i_step(core, cycle - core->cycle);
+	return core->cycle;
+}
+
+int rv32i_undo_reverse(rv32i_undo* undo, const struct rv32i_undo_stop* stop, int n)
+{
+	rv32i_core* core = undo->core;
+
+	while (core->cycle > undo->first && !undo->cut) {
+		int hit = pop_frame(undo, stop, n);
+		if (hit >= 0) return hit;
+	}
+
+	// before the log: replay the checkpoint intervals, newest first, for the last stop in each
+	uint64_t end = core->cycle;
+	for (int k = undo->ckpts - 1; k >= 0; k--) {
+		if (undo->ckpt[k].cycle >= end) continue;
+		ckpt_restore(undo, k);
+		undo->stop = stop;
+		undo->stops = n;
+		undo->hit = -1;
+		undo->found = NOT_FOUND;
+		rv32i_step(core, end - core->cycle);
+		undo->stop = NULL;
+		if (undo->found != NOT_FOUND) {
+			rv32i_undo_goto(undo, undo->found);
+			return undo->found_stop;
+		}
+		end = undo->ckpt[k].cycle;
+	}
+	rv32i_undo_goto(undo, undo->ckpt[0].cycle);
+	return -1;
+}
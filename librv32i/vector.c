@@ -0,0 +1,214 @@
+/* **************************************
+ * Module: Zve32x vector unit of the single-cycle engine
+ *
+ * - The subset of isa/rvv.isa: vsetvli, unit-stride vle/vse of 8/16/32-bit
+ *   elements, integer add/sub/logic/shift/compare in .vv/.vx/.vi forms,
+ *   vmerge/vmv.v, vredsum.vs, vmv.x.s, vmv.s.x, vcpop.m and vfirst.m
+ * - VLEN is rv32i_config.vlen (128 or 256), LMUL is 1: vsetvli with another
+ *   LMUL or SEW 64 sets vill and vl 0, and the vector instructions are nops
+ *   until the next vsetvli
+ * - Tails and masked-off elements are left undisturbed (legal for both
+ *   the agnostic and the undisturbed policies)
+ * - An operation runs on a whole register at once with the vector types of
+ *   the host compiler (SSE/AVX/NEON), masked by the elements it may write
+ * - Loads and stores go element by element through the byte lanes of dmem
+ *   (rv32i_core_load_lanes), so any alignment works; each element is one
+ *   memory access for the callbacks; the elements past VLEN of an EEW
+ *   wider than SEW (a register group) are dropped
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+#include <string.h>
+
+#define FORM_VI 3	// operand forms of OP-V (funct3) that take a scalar
+#define FORM_VX 4
+
+// fields of an OP-V/vector load/store word
+#define VD(inst) (((inst) >> 7) & 0x1f)
+#define VS1(inst) (((inst) >> 15) & 0x1f)
+#define VS2(inst) (((inst) >> 20) & 0x1f)
+#define VM(inst) (((inst) >> 25) & 0x1)		// 1: unmasked
+#define SIMM5(inst) ((uint32_t)((int32_t)((inst) << 12) >> 27))
+
+static inline int mask_bit(const uint8_t* v, uint32_t i)
+{
+	return (v[i >> 3] >> (i & 7)) & 1;
+}
+
+static inline void set_mask_bit(uint8_t* v, uint32_t i, int bit)
+{
+	v[i >> 3] = (v[i >> 3] & ~(1 << (i & 7))) | (bit << (i & 7));
+}
+
+/* the operations of one element width: T unsigned, S signed
+ * op of the elements of vs2 and vs1 (or x for .vx/.vi) into vd, where en is all ones
+ * in the elements that are written: below vl, and active in v0 unless vm
+ */
+#define VEC_SEW(N, T, S) \
+typedef T vu##N __attribute__((vector_size(VLENB_MAX))); \
+typedef S vs##N __attribute__((vector_size(VLENB_MAX))); \
+\
+static void vec_op##N(uint8_t op, uint8_t* vd, const uint8_t* vs2, const uint8_t* vs1, int use_x, T x, \
+	const uint8_t* v0, int vm, uint32_t vl) \
+{ \
+	vu##N a, b, old, r, body, active, en; \
+	memcpy(&a, vs2, VLENB_MAX); \
+	if (use_x) b = (vu##N){ 0 } + x; \
+	else memcpy(&b, vs1, VLENB_MAX); \
+	memcpy(&old, vd, VLENB_MAX); \
+	for (uint32_t i = 0; i < VLENB_MAX / sizeof(T); i++) { \
+		body[i] = (i < vl) ? (T)-1 : 0; \
+		active[i] = mask_bit(v0, i) ? (T)-1 : 0; \
+	} \
+	en = vm ? body : (body & active); \
+	\
+	switch (op) \
+	{ \
+	case VEC_ADD: r = a + b; break; \
+	case VEC_SUB: r = a - b; break; \
+	case VEC_RSUB: r = b - a; break; \
+	case VEC_AND: r = a & b; break; \
+	case VEC_OR: r = a | b; break; \
+	case VEC_XOR: r = a ^ b; break; \
+	case VEC_SLL: r = a << (b & (N - 1)); break; \
+	case VEC_SRL: r = a >> (b & (N - 1)); break; \
+	case VEC_SRA: r = (vu##N)((vs##N)a >> (vs##N)(b & (N - 1))); break; \
+	case VEC_MERGE: /* vm: vmv.v, otherwise v0 selects between vs1/x and vs2 */ \
+		r = vm ? b : ((b & active) | (a & ~active)); \
+		en = body; \
+		break; \
+	case VEC_SEQ: r = (vu##N)(a == b); break; \
+	case VEC_SNE: r = (vu##N)(a != b); break; \
+	case VEC_SLTU: r = (vu##N)(a < b); break; \
+	case VEC_SLT: r = (vu##N)((vs##N)a < (vs##N)b); break; \
+	case VEC_SLEU: r = (vu##N)(a <= b); break; \
+	case VEC_SLE: r = (vu##N)((vs##N)a <= (vs##N)b); break; \
+	case VEC_SGTU: r = (vu##N)(a > b); break; \
+	case VEC_SGT: r = (vu##N)((vs##N)a > (vs##N)b); break; \
+	case VEC_REDSUM: { /* vd[0] = vs1[0] + the active elements of vs2 */ \
+		T sum; \
+		memcpy(&sum, vs1, sizeof(T)); \
+		r = a & en; \
+		for (uint32_t i = 0; i < vl; i++) sum += r[i]; \
+		if (vl) memcpy(vd, &sum, sizeof(T)); \
+		return; \
+	} \
+	default: \
+		return; \
+	} \
+	\
+	if (op >= VEC_SEQ && op <= VEC_SGT) { /* a mask: bit i of vd */ \
+		for (uint32_t i = 0; i < vl; i++) if (en[i]) set_mask_bit(vd, i, r[i] & 1); \
+		return; \
+	} \
+	r = (r & en) | (old & ~en); \
+	memcpy(vd, &r, VLENB_MAX); \
+}
+
+VEC_SEW(8, uint8_t, int8_t)
+VEC_SEW(16, uint16_t, int16_t)
+VEC_SEW(32, uint32_t, int32_t)
+
+// vsetvli: vl for the AVL of rs1 (VLMAX if rs1 is x0 and rd isn't, vl kept if both are x0)
+static uint32_t vec_cfg(rv32i_core* core, uint32_t inst, uint32_t rs1_dout)
+{
+	struct rv32i_vec* v = &core->vec;
+	uint32_t zimm = (inst >> 20) & 0x7ff;
+	uint32_t vsew = (zimm >> 3) & 0x7, vlmul = zimm & 0x7;
+
+	if ((zimm >> 8) || vsew > 2 || vlmul != 0) {
+		v->vtype = VTYPE_ILL;
+		v->vl = 0;
+		return 0;
+	}
+	uint32_t vlmax = core->cfg.vlen >> (3 + vsew);
+	if (VS1(inst) != 0) v->vl = (rs1_dout < vlmax) ? rs1_dout : vlmax;
+	else if (VD(inst) != 0) v->vl = vlmax;
+	else if (v->vl > vlmax) v->vl = vlmax;	// keeps vl, clipped for an in-between SEW change
+	v->vtype = zimm;
+	return v->vl;
+}
+
+// vle/vse: width in bytes from funct3, element i at rs1 + i * width
+static void vec_mem(rv32i_core* core, uint32_t pc, uint32_t inst, int store, uint32_t addr)
+{
+	struct rv32i_vec* v = &core->vec;
+	uint32_t f3 = (inst >> 12) & 0x7;
+	int size = (f3 == 0) ? 1 : (f3 == 5) ? 2 : 4;
+	uint8_t* vd = v->v[VD(inst)];
+	uint32_t n = v->vl;
+	if (n * size > core->cfg.vlen / 8u) n = core->cfg.vlen / 8u / size;	// an EEW above SEW would need a register group
+
+	for (uint32_t i = 0; i < n; i++, addr += size) {
+		if (!VM(inst) && !mask_bit(v->v[0], i)) continue;
+		uint32_t elem = 0;
+		if (store) {
+			memcpy(&elem, vd + i * size, size);
+			rv32i_core_store_lanes(core, addr, size, elem);
+			rv32i_core_snoop(core, addr);
+			if (LANES_CROSS(addr, size)) rv32i_core_snoop(core, addr + 4);
+		}
+		else {
+			elem = rv32i_core_load_lanes(core, addr, size);
+			memcpy(vd + i * size, &elem, size);
+		}
+		rv32i_core_mem(core, pc, addr, size == 4 ? elem : elem & ((1u << 8 * size) - 1), store);
+	}
+}
+
+// vmv.x.s, vcpop.m and vfirst.m (vs1 field)
+static uint32_t vec_wxunary(rv32i_core* core, uint32_t inst, uint32_t sew)
+{
+	struct rv32i_vec* v = &core->vec;
+	const uint8_t* vs2 = v->v[VS2(inst)];
+
+	if (VS1(inst) == 0) {	// element 0, sign-extended
+		uint32_t w;
+		memcpy(&w, vs2, 4);
+		return (sew == 32) ? w : (uint32_t)((int32_t)(w << (32 - sew)) >> (32 - sew));
+	}
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < v->vl; i++) {
+		if (!mask_bit(vs2, i) || (!VM(inst) && !mask_bit(v->v[0], i))) continue;
+		if (VS1(inst) == 17) return i;	// vfirst.m
+		count++;
+	}
+	return (VS1(inst) == 17) ? 0xffffffff : count;
+}
+
+uint32_t rv32i_core_vec(rv32i_core* core, uint32_t pc, uint32_t inst, uint8_t vec, uint32_t rs1_dout)
+{
+	struct rv32i_vec* v = &core->vec;
+	if (vec == VEC_CFG) return vec_cfg(core, inst, rs1_dout);
+	if (v->vtype & VTYPE_ILL) return 0;
+
+	uint32_t sew = 8 << ((v->vtype >> 3) & 0x7);
+	uint32_t form = (inst >> 12) & 0x7;
+	uint8_t* vd = v->v[VD(inst)];
+
+	switch (vec)
+	{
+	case VEC_LOAD:
+	case VEC_STORE:
+		vec_mem(core, pc, inst, vec == VEC_STORE, rs1_dout);
+		return 0;
+	case VEC_WXUNARY:
+		return vec_wxunary(core, inst, sew);
+	case VEC_RXUNARY:	// vmv.s.x
+		if (v->vl) memcpy(vd, &rs1_dout, sew / 8);
+		return 0;
+	}
+
+	int use_x = (form == FORM_VX || form == FORM_VI);
+	uint32_t x = (form == FORM_VI) ? SIMM5(inst) : rs1_dout;
+	const uint8_t* vs1 = v->v[VS1(inst)];
+	const uint8_t* vs2 = v->v[VS2(inst)];
+	if (sew == 8) vec_op8(vec, vd, vs2, vs1, use_x, (uint8_t)x, v->v[0], VM(inst), v->vl);
+	else if (sew == 16) vec_op16(vec, vd, vs2, vs1, use_x, (uint16_t)x, v->v[0], VM(inst), v->vl);
+	else vec_op32(vec, vd, vs2, vs1, use_x, x, v->v[0], VM(inst), v->vl);
+	return 0;
+}
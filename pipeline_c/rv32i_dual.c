@@ -0,0 +1,50 @@
+/* **************************************
+ * Module: top design of rv32i dual-issue in-order pipelined processor
+ *
+ * - Two-wide version of rv32i_pipeline (see librv32i/dual.c)
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "librv32i.h"
+#include <stdlib.h>
+
+#define CLK_NUM 50
+
+int main(int argc, char* argv[]) {
+
+	// get input arguments
+	if (argc < 3) {
+		printf("usage: %s imem_data_file dmem_data_file [clock_count]\n", argv[0]);
+		exit(1);
+	}
+
+	rv32i_core* core = rv32i_create(RV32I_DUAL);
+	int i, n;
+
+	printf("\n*** Reading %s ***\n", argv[1]);	//read imem
+	if ((n = rv32i_load_file(core, RV32I_IMEM, argv[1])) < 0) {
+		printf((n == RV32I_ERR_OPEN) ? "Cannot find %s\n" : "Incorrect format!!\n", argv[1]);
+		exit(1);
+	}
+	for (i = 0; i < n; i++) printf("imem[%03d]: %08X\n", i, rv32i_read_mem(core, RV32I_IMEM, i << 2));
+
+	printf("\n*** Reading %s ***\n", argv[2]);	//read dmem
+	if ((n = rv32i_load_file(core, RV32I_DMEM, argv[2])) < 0) {
+		printf("Cannot find %s\n", argv[2]);
+		exit(1);
+	}
+	for (i = 0; i < n; i++) printf("dmem[%03d]: %08X\n", i, rv32i_read_mem(core, RV32I_DMEM, i << 2));
+
+	// processor model
+	uint64_t clk_num = (argc > 3) ? strtoull(argv[3], NULL, 0) : CLK_NUM;
+	if (clk_num > 2) rv32i_step(core, clk_num - 2);	// clock count starts at 2
+
+	rv32i_show_state(core);
+	rv32i_report(core, stdout);
+	rv32i_destroy(core);
+
+	return 0;
+}
@@ -0,0 +1,112 @@
+// generated by isa/gen_decoder.py from isa/rv32i.isa, do not edit
+/* ********************************************
+ *	Module: instruction decoder (decoder.sv)
+ *  - Main control unit, ALU control unit and immediate generator
+ *
+ *  Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * ********************************************
+ */
+
+`timescale 1ns/1ps
+
+module decoder
+(
+    input   [31:0]  inst,
+    output  [6:0]   opcode,
+    output  [2:0]   funct3,
+    output  [6:0]   funct7,
+    output  [4:0]   rs1,            // 0 if the instruction doesn't read rs1
+    output  [4:0]   rs2,            // 0 if the instruction doesn't read rs2
+    output  [4:0]   rd,
+    output  logic [31:0]  imm32,
+    output  [6:0]   branch,
+    output          alu_src,
+    output  [1:0]   alu_op,
+    output  [3:0]   alu_control,
+    output          slt,
+    output          mem_read,
+    output          mem_write,
+    output          mem_to_reg,
+    output          reg_write
+);
+
+    localparam IMM_NONE = 3'd0, IMM_I = 3'd1, IMM_S = 3'd2, IMM_B = 3'd3, IMM_J = 3'd4, IMM_U = 3'd5, IMM_SHAMT = 3'd6;
+
+    logic           use_rs1, use_rs2;
+    logic   [2:0]   imm;
+    logic   [23:0]  ctrl;
+
+    assign opcode = inst[6:0];
+    assign funct3 = inst[14:12];
+    assign funct7 = inst[31:25];
+
+    assign {alu_op, alu_control, slt, branch, alu_src, mem_read, mem_write, mem_to_reg, reg_write, use_rs1, use_rs2, imm} = ctrl;
+
+    always_comb begin
+        casez ({opcode, funct3, funct7})
+            17'b0000011_000_???????: ctrl = {2'b00, 4'd2, 1'b0, 7'b0000000, 1'b1, 1'b1, 1'b0, 1'b1, 1'b1, 1'b1, 1'b0, IMM_I};   // lb
+            17'b0000011_001_???????: ctrl = {2'b00, 4'd2, 1'b0, 7'b0000000, 1'b1, 1'b1, 1'b0, 1'b1, 1'b1, 1'b1, 1'b0, IMM_I};   // lh
+            17'b0000011_010_???????: ctrl = {2'b00, 4'd2, 1'b0, 7'b0000000, 1'b1, 1'b1, 1'b0, 1'b1, 1'b1, 1'b1, 1'b0, IMM_I};   // lw
+            17'b0000011_100_???????: ctrl = {2'b00, 4'd2, 1'b0, 7'b0000000, 1'b1, 1'b1, 1'b0, 1'b1, 1'b1, 1'b1, 1'b0, IMM_I};   // lbu
+            17'b0000011_101_???????: ctrl = {2'b00, 4'd2, 1'b0, 7'b0000000, 1'b1, 1'b1, 1'b0, 1'b1, 1'b1, 1'b1, 1'b0, IMM_I};   // lhu
+            17'b0000011_???_???????: ctrl = {2'b00, 4'd2, 1'b0, 7'b0000000, 1'b1, 1'b1, 1'b0, 1'b1, 1'b1, 1'b1, 1'b0, IMM_I};
+            17'b0100011_000_???????: ctrl = {2'b00, 4'd2, 1'b0, 7'b0000000, 1'b1, 1'b0, 1'b1, 1'b0, 1'b0, 1'b1, 1'b1, IMM_S};   // sb
+            17'b0100011_001_???????: ctrl = {2'b00, 4'd2, 1'b0, 7'b0000000, 1'b1, 1'b0, 1'b1, 1'b0, 1'b0, 1'b1, 1'b1, IMM_S};   // sh
+            17'b0100011_010_???????: ctrl = {2'b00, 4'd2, 1'b0, 7'b0000000, 1'b1, 1'b0, 1'b1, 1'b0, 1'b0, 1'b1, 1'b1, IMM_S};   // sw
+            17'b0100011_???_???????: ctrl = {2'b00, 4'd2, 1'b0, 7'b0000000, 1'b1, 1'b0, 1'b1, 1'b0, 1'b0, 1'b1, 1'b1, IMM_S};
+            17'b1100011_000_???????: ctrl = {2'b01, 4'd6, 1'b0, 7'b0000001, 1'b0, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, IMM_B};   // beq
+            17'b1100011_001_???????: ctrl = {2'b01, 4'd6, 1'b0, 7'b0000010, 1'b0, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, IMM_B};   // bne
+            17'b1100011_100_???????: ctrl = {2'b01, 4'd6, 1'b0, 7'b0000100, 1'b0, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, IMM_B};   // blt
+            17'b1100011_101_???????: ctrl = {2'b01, 4'd6, 1'b0, 7'b0001000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, IMM_B};   // bge
+            17'b1100011_110_???????: ctrl = {2'b01, 4'd6, 1'b0, 7'b0010000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, IMM_B};   // bltu
+            17'b1100011_111_???????: ctrl = {2'b01, 4'd6, 1'b0, 7'b0100000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, IMM_B};   // bgeu
+            17'b1100011_???_???????: ctrl = {2'b01, 4'd6, 1'b0, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, IMM_B};
+            17'b0110011_000_0000000: ctrl = {2'b10, 4'd2, 1'b0, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b1, IMM_NONE};   // add
+            17'b0110011_000_0100000: ctrl = {2'b10, 4'd6, 1'b0, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b1, IMM_NONE};   // sub
+            17'b0110011_001_0000000: ctrl = {2'b10, 4'd7, 1'b0, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b1, IMM_NONE};   // sll
+            17'b0110011_010_0000000: ctrl = {2'b10, 4'd6, 1'b1, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b1, IMM_NONE};   // slt
+            17'b0110011_011_0000000: ctrl = {2'b10, 4'd6, 1'b1, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b1, IMM_NONE};   // sltu
+            17'b0110011_100_0000000: ctrl = {2'b10, 4'd3, 1'b0, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b1, IMM_NONE};   // xor
+            17'b0110011_101_0000000: ctrl = {2'b10, 4'd8, 1'b0, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b1, IMM_NONE};   // srl
+            17'b0110011_101_0100000: ctrl = {2'b10, 4'd9, 1'b0, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b1, IMM_NONE};   // sra
+            17'b0110011_110_0000000: ctrl = {2'b10, 4'd1, 1'b0, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b1, IMM_NONE};   // or
+            17'b0110011_111_0000000: ctrl = {2'b10, 4'd0, 1'b0, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b1, IMM_NONE};   // and
+            17'b0110011_???_???????: ctrl = {2'b10, 4'd0, 1'b0, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b1, IMM_NONE};
+            17'b0010011_000_???????: ctrl = {2'b11, 4'd2, 1'b0, 7'b0000000, 1'b1, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b0, IMM_I};   // addi
+            17'b0010011_001_0000000: ctrl = {2'b11, 4'd7, 1'b0, 7'b0000000, 1'b1, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b0, IMM_SHAMT};   // slli
+            17'b0010011_010_???????: ctrl = {2'b11, 4'd6, 1'b1, 7'b0000000, 1'b1, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b0, IMM_I};   // slti
+            17'b0010011_011_???????: ctrl = {2'b11, 4'd6, 1'b1, 7'b0000000, 1'b1, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b0, IMM_I};   // sltiu
+            17'b0010011_100_???????: ctrl = {2'b11, 4'd3, 1'b0, 7'b0000000, 1'b1, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b0, IMM_I};   // xori
+            17'b0010011_101_0000000: ctrl = {2'b11, 4'd8, 1'b0, 7'b0000000, 1'b1, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b0, IMM_SHAMT};   // srli
+            17'b0010011_101_0100000: ctrl = {2'b11, 4'd9, 1'b0, 7'b0000000, 1'b1, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b0, IMM_SHAMT};   // srai
+            17'b0010011_110_???????: ctrl = {2'b11, 4'd1, 1'b0, 7'b0000000, 1'b1, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b0, IMM_I};   // ori
+            17'b0010011_111_???????: ctrl = {2'b11, 4'd0, 1'b0, 7'b0000000, 1'b1, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b0, IMM_I};   // andi
+            17'b0010011_???_???????: ctrl = {2'b11, 4'd0, 1'b0, 7'b0000000, 1'b1, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b0, IMM_I};
+            17'b1101111_???_???????: ctrl = {2'b00, 4'd2, 1'b0, 7'b1000000, 1'b1, 1'b0, 1'b0, 1'b0, 1'b1, 1'b0, 1'b0, IMM_J};   // jal
+            17'b1100111_???_???????: ctrl = {2'b00, 4'd2, 1'b0, 7'b1000000, 1'b1, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, 1'b0, IMM_I};   // jalr
+            17'b0010111_???_???????: ctrl = {2'b00, 4'd2, 1'b0, 7'b0000000, 1'b1, 1'b0, 1'b0, 1'b0, 1'b1, 1'b0, 1'b0, IMM_U};   // auipc
+            17'b0110111_???_???????: ctrl = {2'b00, 4'd2, 1'b0, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b0, 1'b0, IMM_U};   // lui
+            17'b1110011_000_0000000: ctrl = {2'b00, 4'd2, 1'b0, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b0, 1'b0, 1'b0, IMM_I};   // ecall
+            17'b1110011_???_???????: ctrl = {2'b00, 4'd2, 1'b0, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b0, 1'b0, 1'b0, IMM_I};
+            default: ctrl = {2'b00, 4'd2, 1'b0, 7'b0000000, 1'b0, 1'b0, 1'b0, 1'b0, 1'b0, 1'b1, 1'b1, IMM_NONE};
+        endcase
+    end
+
+    assign rs1 = use_rs1 ? inst[19:15] : 5'd0;
+    assign rs2 = use_rs2 ? inst[24:20] : 5'd0;
+    assign rd = inst[11:7];
+
+    always_comb begin
+        case (imm)
+            IMM_I:      imm32 = {{20{inst[31]}}, inst[31:20]};
+            IMM_S:      imm32 = {{20{inst[31]}}, inst[31:25], inst[11:7]};
+            IMM_B:      imm32 = {{20{inst[31]}}, inst[31], inst[7], inst[30:25], inst[11:8]};
+            IMM_J:      imm32 = {{12{inst[31]}}, inst[31], inst[19:12], inst[20], inst[30:21]};
+            IMM_U:      imm32 = {{12{inst[31]}}, inst[31:12]};
+            IMM_SHAMT:  imm32 = {27'd0, inst[24:20]};
+            default:    imm32 = 32'd0;
+        endcase
+    end
+
+endmodule
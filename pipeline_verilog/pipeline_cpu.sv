@@ -30,6 +30,8 @@ typedef struct packed {
     logic   [6:0]   branch;
     logic           alu_src;
     logic   [1:0]   alu_op;
+    logic   [3:0]   alu_control;
+    logic           slt;
     logic           mem_read;
     logic           mem_write;
     logic   [4:0]   rs1;
@@ -165,153 +167,43 @@ module pipeline_cpu
      */
     
     // -------------------------------------------------------------------
-    /* Main control unit:
-     * Main control unit generates control signals for datapath elements
-     * The control signals are determined by decoding instructions
+    /* Decoder:
+     * Main control unit, ALU control unit and immediate generator
+     * (decoder.sv is generated from isa/rv32i.isa)
      */
     logic   [6:0]   opcode;
     logic   [6:0]   branch;
     logic           alu_src, mem_to_reg;
     logic   [1:0]   alu_op;
+    logic   [3:0]   alu_control;    // ALU control signal
+    logic           slt;
     logic           mem_read, mem_write, reg_write;
     logic   [6:0]   funct7;
     logic   [2:0]   funct3;
-
-    // COMPLETE THE MAIN CONTROL UNIT HERE
-    assign opcode = id.inst[6:0];
-    assign funct3 = id.inst[14:12];
-    assign funct7 = id.inst[31:25];
-
-    always_comb begin
-        if(opcode == 7'b1100011) begin  //conditional branch
-            branch[0] = (funct3 == 3'b000);    //beq
-            branch[1] = (funct3 == 3'b001);    //bne
-            branch[2] = (funct3 == 3'b100);    //blt
-            branch[3] = (funct3 == 3'b101);    //bge
-            branch[4] = (funct3 == 3'b110);    //bltu
-            branch[5] = (funct3 == 3'b111);    //bgeu
-        end
-        else if(opcode == 7'b1101111 || opcode == 7'b1100111) begin    //unconditional branch (jal, jalr)
-            branch[6] = 1'b1;
-        end
-        else begin
-            branch = 7'b0;
-        end
-    end
-
-    assign mem_read = (opcode == 7'b0000011);    // ld
-    assign mem_write = (opcode == 7'b0100011);   // sd
-    assign mem_to_reg = mem_read;
-    assign reg_write = (opcode == 7'b0000011||opcode == 7'b0110011||opcode == 7'b0010011||opcode == 7'b1100111||opcode == 7'b1101111||opcode == 7'b0110111||opcode == 7'b0010111);
-    assign alu_src = (opcode == 7'b0000011||opcode == 7'b0100011||opcode == 7'b0010011||opcode == 7'b1100111||opcode == 7'b1101111||opcode == 7'b0010111);
-
-    always_comb begin
-        case(opcode)
-            7'b0000011: begin    //loads
-                alu_op = 2'b00;
-            end
-            7'b0100011: begin    //stores
-                alu_op = 2'b00;
-            end
-            7'b1100011: begin    //conditinal branches
-                alu_op = 2'b01;
-            end
-            7'b0110011: begin    //rtype
-                alu_op = 2'b10;
-            end
-            7'b0010011: begin   //itype
-                alu_op = 2'b11;
-            end
-            7'b1101111: begin   //jal
-                alu_op = 2'b00;
-            end
-            7'b1100111: begin   //jalr
-                alu_op = 2'b00;
-            end
-            7'b0010111: begin   //auipc
-                alu_op = 2'b00;
-            end
-            default: begin
-                alu_op = 2'b00;
-            end
-        endcase
-    end
-    // --------------------------------------------------------------------
-
-    // ---------------------------------------------------------------------
-    /* Immediate generator:
-     * Generating immediate value from inst[31:0]
-     */
+    logic   [4:0]   rs1, rs2, rd;   // register numbers, rs1/rs2 are 0 if unused
     logic   [31:0]  imm32;
-    logic   [31:0]  imm32_branch;  // imm64 left shifted by 1
-
-    // COMPLETE IMMEDIATE GENERATOR HERE
-    logic   [11:0]  imm12;
-    logic   [19:0]  imm20;  // 20-bit immediate value --> for unconditional branch, upper immediate
-    logic   imm_flag;
-
-    always_comb begin
-        case(opcode)
-            7'b0000011: begin   //ld
-                imm12 = id.inst[31:20];
-                imm_flag = 1'b1;
-            end
-            7'b0100011: begin   //sd
-                imm12[11:5] = id.inst[31:25];
-                imm12[4:0] = id.inst[11:7];
-                imm_flag = 1'b1;
-            end
-            7'b0010011: begin   //i-type
-                imm12 = id.inst[31:20];
-                if(funct3 == 3'b101) begin    //slli, srli, srai
-                    imm12 = {7'd0,imm12[4:0]};
-                end
-                imm_flag = 1'b1;
-            end
-            7'b1100011: begin   //conditional branch
-                imm12[11] = id.inst[31];
-                imm12[9:4] = id.inst[30:25];
-                imm12[3:0] = id.inst[11:8];
-                imm12[10] = id.inst[7];
-                imm_flag = 1'b1;
-            end
-            7'b1101111: begin //unconditional branch - jal
-                imm20[19] = id.inst[31];
-                imm20[9:0] = id.inst[30:21];
-                imm20[10] = id.inst[20];
-                imm20[18:11] = id.inst[19:12];
-                imm_flag = 1'b0;
-            end
-            7'b1100111: begin   //unconditional branch - jalr
-                imm12 = id.inst[31:20];
-                imm_flag = 1'b1;
-            end
-            7'b0010111: begin   //auipc
-                imm20 = id.inst[31:12];
-                imm_flag = 1'b0;
-            end
-            7'b0110111: begin   //lui
-                imm20 = id.inst[31:12];
-                imm_flag = 1'b0;
-            end
-            default: begin
-            end
-        endcase
-    end
+    logic   [31:0]  imm32_branch;  // imm32 left shifted by 1
 
-    always_comb begin
-        if(imm_flag) begin
-            if((opcode == 7'b0010011 && funct3 == 3'b011) && (opcode == 7'b1100011 && (funct3 == 3'b110 || funct3 == 3'b111))) begin
-                imm32 = {20'd0,imm12};         //bit extension (unsigned)
-            end
-            else begin
-                imm32 = {{20{imm12[11]}},imm12};    //sign extension
-            end
-        end
-        else begin
-            imm32 = {{12{imm20[19]}},imm20};    //sign extension
-        end
-    end
+    decoder u_decoder_0 (
+        .inst               (id.inst),
+        .opcode             (opcode),
+        .funct3             (funct3),
+        .funct7             (funct7),
+        .rs1                (rs1),
+        .rs2                (rs2),
+        .rd                 (rd),
+        .imm32              (imm32),
+        .branch             (branch),
+        .alu_src            (alu_src),
+        .alu_op             (alu_op),
+        .alu_control        (alu_control),
+        .slt                (slt),
+        .mem_read           (mem_read),
+        .mem_write          (mem_write),
+        .mem_to_reg         (mem_to_reg),
+        .reg_write          (reg_write)
+    );
+    // --------------------------------------------------------------------
 
     // Computing branch target
     always_comb begin
@@ -333,8 +225,6 @@ module pipeline_cpu
      * - Detecting data hazards from load instrcutions
      * - Detecting control hazards from taken branches
      */
-    logic   [4:0]   rs1, rs2;
-
     logic           stall_by_load_use;
     logic           flush_by_branch;
     
@@ -355,13 +245,9 @@ module pipeline_cpu
 
 
     // regfile/
-    logic   [4:0]   rd;    // register numbers
     logic   [REG_WIDTH-1:0] rd_din;
     logic   [REG_WIDTH-1:0] rs1_dout, rs2_dout;
     
-    assign rs1 =  (opcode != 7'b0110111 && opcode != 7'b0010111 && opcode != 7'b1101111) ? id.inst[19:15]:'b0;     //lui, auipc, jal don't use rs1
-    assign rs2 =  (opcode != 7'b0110111 && opcode != 7'b0010111 && opcode != 7'b1101111 && opcode != 7'b1100111 && opcode != 7'b0000011 && opcode != 7'b0010011) ? id.inst[24:20]:'b0;     // ld, itype, lui, auipc, jal, jalr don't use rs2
-    assign rd =  id.inst[11:7];
     // rd, rd_din, and reg_write will be determined in WB stage
     
     // instantiation of register file
@@ -401,6 +287,8 @@ module pipeline_cpu
                 ex.branch <= branch;
                 ex.alu_src <= alu_src;
                 ex.alu_op <= alu_op;
+                ex.alu_control <= alu_control;
+                ex.slt <= slt;
                 ex.mem_read <= mem_read;
                 ex.mem_write <= mem_write;
                 ex.rs1 <= rs1;
@@ -434,70 +322,10 @@ module pipeline_cpu
 
     // ------------------------------------------------------------------
     /* Execution stage:
-     * - ALU & ALU control
+     * - ALU
      * - Data forwarding unit
      */
 
-    // --------------------------------------------------------------------
-    /* ALU control unit:
-     * ALU control unit generate alu_control signal which selects ALU operations
-     * Generating control signals using alu_op, funct7, and funct3 fileds
-     */
-
-    logic   [3:0]   alu_control;    // ALU control signal
-
-    // COMPLETE ALU CONTROL UNIT
-	logic slt;
-    always_comb begin
-        if(ex.alu_op == 2'b00) begin
-            alu_control = 4'b0010;  //add
-            slt = 1'b0;
-        end
-        else if(ex.alu_op == 2'b01) begin  //conditional branches
-            alu_control = 4'b0110;      //sub --> to compare
-            slt = 1'b0;
-        end
-        else begin
-            if(ex.funct3 == 3'd0 && ((ex.alu_op == 2'b10 && ex.funct7 == 7'd0) || (ex.alu_op == 2'b11))) begin  //add
-                alu_control = 4'b0010;
-                slt = 1'b0;
-            end
-            else if(ex.funct3 == 3'd0 && ex.funct7 == 7'b0100000) begin //sub
-                alu_control = 4'b0110;
-                slt = 1'b0;
-            end
-            else if(ex.funct3 == 3'b111 && ex.funct7 == 7'd0) begin   //and
-                alu_control = 4'b0000;
-                slt = 1'b0;
-            end
-            else if(ex.funct3 == 3'b110) begin   //or
-                alu_control = 4'b0001;
-                slt = 1'b0;
-            end
-            else if(ex.funct3 == 3'b100) begin   //xor
-                alu_control = 4'b0011;
-                slt = 1'b0;
-            end
-            else if(ex.funct3 == 3'b001 && ex.funct7 == 7'd0) begin   //shift left
-                alu_control = 4'b0111;
-                slt = 1'b0;
-            end
-            else if(ex.funct3 == 3'b101 && ex.funct7 == 7'd0) begin   //shift right
-                alu_control = 4'b1000;
-                slt = 1'b0;
-            end
-            else if(ex.funct3 == 3'b101 && ex.funct7 == 7'b0100000) begin //shift right arithmetic
-                alu_control = 4'b1001;
-                slt = 1'b0;
-            end
-            else if(ex.funct3 == 3'b010 || ex.funct3 == 3'b011) begin //set less than
-                alu_control = 4'b0110;
-                slt = 1'b1;
-            end
-        end
-    end
-    // ---------------------------------------------------------------------
-
     // ----------------------------------------------------------------------
     /* Forwarding unit:
      * - Forwarding from EX/MEM and MEM/WB
@@ -569,7 +397,8 @@ module pipeline_cpu
 
     //unconditional branch or auipc
     assign alu_in1 = (ex.branch[6] || ex.opcode == 7'b0010111) ? ex.pc : alu_fwd_in1;
-    assign alu_in2 =  ex.alu_src ? ex.imm32 : alu_fwd_in2;
+    //auipc: imm32 is the upper immediate like lui's
+    assign alu_in2 = (ex.opcode == 7'b0010111) ? {ex.imm32[19:0], 12'd0} : ex.alu_src ? ex.imm32 : alu_fwd_in2;
 
     // instantiation: ALU
     alu #(
@@ -577,7 +406,7 @@ module pipeline_cpu
     ) u_alu_0 (
         .in1                (alu_in1),
         .in2                (alu_in2),
-        .alu_control        (alu_control),
+        .alu_control        (ex.alu_control),
         .result             (alu_result)
     );
 
@@ -629,7 +458,7 @@ module pipeline_cpu
             mem.mem_to_reg <= ex.mem_to_reg;
             mem.funct3 <= ex.funct3;
             mem.opcode <= ex.opcode;
-            mem.slt <= slt;
+            mem.slt <= ex.slt;
             mem.imm32 <= ex.imm32;
             mem.pc <= ex.pc;
             mem.sign <= bu_sign;
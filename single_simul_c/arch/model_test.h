@@ -0,0 +1,54 @@
+/* **************************************
+ * riscv-arch-test target of librv32i (rv32i_arch)
+ *
+ * - The test halts by writing 1 to tohost and spinning, which every engine
+ *   can do; rv32i_arch stops a core at that store
+ * - The signature is the words from begin_signature to end_signature,
+ *   rv32i_arch dumps it from dmem and compares it with the reference
+ * - No console and no interrupts: the IO and interrupt macros are empty
+ * - Link with link.ld, code and data from address 0 (see elf.c)
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#ifndef _COMPLIANCE_MODEL_H
+#define _COMPLIANCE_MODEL_H
+
+#define RVMODEL_DATA_SECTION \
+	.pushsection .tohost,"aw",@progbits; \
+	.align 8; .global tohost; tohost: .dword 0; \
+	.align 8; .global fromhost; fromhost: .dword 0; \
+	.popsection; \
+	.align 8; .global begin_regstate; begin_regstate: .word 128; \
+	.align 8; .global end_regstate; end_regstate: .word 4;
+
+#define RVMODEL_HALT \
+	li x1, 1; \
+write_tohost: \
+	sw x1, tohost, t5; \
+	j write_tohost;
+
+#define RVMODEL_BOOT
+
+#define RVMODEL_DATA_BEGIN \
+	RVMODEL_DATA_SECTION \
+	.align 4; .global begin_signature; begin_signature:
+
+#define RVMODEL_DATA_END \
+	.align 4; .global end_signature; end_signature:
+
+#define RVMODEL_IO_INIT
+#define RVMODEL_IO_WRITE_STR(_R, _STR)
+#define RVMODEL_IO_CHECK()
+#define RVMODEL_IO_ASSERT_GPR_EQ(_S, _R, _I)
+#define RVMODEL_IO_ASSERT_SFPR_EQ(_F, _R, _I)
+#define RVMODEL_IO_ASSERT_DFPR_EQ(_D, _R, _I)
+
+#define RVMODEL_SET_MSW_INT
+#define RVMODEL_CLEAR_MSW_INT
+#define RVMODEL_CLEAR_MTIMER_INT
+#define RVMODEL_CLEAR_MEXT_INT
+
+#endif
@@ -0,0 +1,351 @@
+/* **************************************
+ * Module: architecture test runner
+ *
+ * - Runs riscv-arch-test programs (built with arch/model_test.h and
+ *   arch/link.ld) on every engine, on a pool of host threads
+ * - A test halts when it stores to tohost, then the words from
+ *   begin_signature to end_signature are read from dmem and compared with
+ *   its reference signature (<name>.reference_output, one hex word per
+ *   line as in the riscv-arch-test references)
+ * - Prints a pass/fail matrix, test by engine, and the first word that
+ *   differs for every failure; -s writes the signatures of all runs
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "librv32i.h"
+#include <dirent.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define TEST_MAX 4096
+
+enum result { PASS, FAIL, HANG, NOREF, LOAD };
+static const char* const result_name[] = { "pass", "FAIL", "hang", "noref", "load" };
+
+struct test {
+	char* elf;
+	char* name;			// file name without .elf
+	uint32_t begin, end, tohost;	// signature and halt addresses
+	uint32_t* ref;
+	int ref_words;		// -1: no reference
+	int error;			// RV32I_ERR_* of the symbols
+};
+
+struct run {
+	int test;
+	enum rv32i_engine engine;
+	// results
+	enum result result;
+	int error;			// LOAD: RV32I_ERR_* of the symbols or the ELF, 0 if the engine refused the config
+	uint32_t* sig;
+	int sig_words;
+	int first_diff;		// word index, FAIL only
+	uint64_t cycles;
+};
+
+struct arch {
+	struct test* test;
+	int tests;
+	struct rv32i_config base;
+	const char* sig_dir;
+	struct run* run;
+	int runs;
+	int next;			// next run to be taken by a worker
+	pthread_mutex_t lock;
+};
+
+struct halt {
+	uint32_t tohost;
+	int stored;
+};
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int is_dir(const char* path)
+{
+	struct stat st;
+	return stat(path, &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+static void on_mem(void* arg, const struct rv32i_mem_access* access)
+{
+	struct halt* h = (struct halt*)arg;
+	if (access->write && (access->addr & ~3u) == h->tohost) h->stored = 1;
+}
+
+static int halted(rv32i_core* core, void* arg)
+{
+	return ((struct halt*)arg)->stored || rv32i_halted(core);
+}
+
+// one hex word per line, returns the count or -1
+static int read_reference(const char* path, uint32_t** words)
+{
+	FILE* fp = fopen(path, "r");
+	char line[128];
+	int n = 0, max = 0;
+
+	*words = NULL;
+	if (!fp) return -1;
+	while (fgets(line, sizeof(line), fp)) {
+		char* end;
+		uint32_t w = (uint32_t)strtoul(line, &end, 16);
+		if (end == line) continue;	// blank line
+		if (n == max) *words = (uint32_t*)realloc(*words, (max = max ? 2 * max : 256) * sizeof(uint32_t));
+		(*words)[n++] = w;
+	}
+	fclose(fp);
+	return n;
+}
+
+static void add_test(struct arch* a, const char* elf, const char* ref_dir)
+{
+	if (a->tests == TEST_MAX) return;
+	struct test* t = &a->test[a->tests++];
+	const char* base = strrchr(elf, '/') ? strrchr(elf, '/') + 1 : elf;
+	size_t len = strlen(base);
+	char path[1024];
+
+	t->elf = strdup(elf);
+	t->name = strndup(base, (len > 4 && !strcmp(base + len - 4, ".elf")) ? len - 4 : len);
+	if ((t->error = rv32i_elf_symbol(elf, "begin_signature", &t->begin)) == 0 &&
+		(t->error = rv32i_elf_symbol(elf, "end_signature", &t->end)) == 0)
+		t->error = rv32i_elf_symbol(elf, "tohost", &t->tohost);
+
+	if (ref_dir) snprintf(path, sizeof(path), "%s/%s.reference_output", ref_dir, t->name);
+	else snprintf(path, sizeof(path), "%.*s%s.reference_output", (int)(base - elf), elf, t->name);
+	t->ref_words = read_reference(path, &t->ref);
+}
+
+static int name_cmp(const void* a, const void* b)
+{
+	return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+// the *.elf files of a directory, by name
+static void add_dir(struct arch* a, const char* dir, const char* ref_dir)
+{
+	DIR* d = opendir(dir);
+	struct dirent* e;
+	char* names[TEST_MAX];
+	int n = 0;
+
+	if (!d) return;
+	while ((e = readdir(d)) != NULL && n < TEST_MAX) {
+		size_t len = strlen(e->d_name);
+		if (len > 4 && !strcmp(e->d_name + len - 4, ".elf")) names[n++] = strdup(e->d_name);
+	}
+	closedir(d);
+	qsort(names, n, sizeof(char*), name_cmp);
+	for (int i = 0; i < n; i++) {
+		char path[1024];
+		snprintf(path, sizeof(path), "%s/%s", dir, names[i]);
+		add_test(a, path, ref_dir);
+		free(names[i]);
+	}
+}
+
+static void execute(struct arch* a, struct run* r)
+{
+	struct test* t = &a->test[r->test];
+	struct rv32i_config cfg = a->base;
+	cfg.engine = r->engine;
+
+	r->result = LOAD;
+	if ((r->error = t->error) < 0) return;
+	rv32i_core* core = rv32i_create_config(&cfg);
+	if (!core) return;
+	if ((r->error = rv32i_load_elf(core, t->elf)) < 0) {
+		rv32i_destroy(core);
+		return;
+	}
+
+	struct halt h = { t->tohost & ~3u, 0 };
+	rv32i_set_mem_cb(core, on_mem, &h);
+	rv32i_run_until(core, halted, &h, cfg.max_cycles);
+	r->cycles = rv32i_get_cycles(core);
+
+	r->sig_words = (t->end > t->begin) ? (t->end - t->begin) / 4 : 0;
+	r->sig = (uint32_t*)malloc((r->sig_words + 1) * sizeof(uint32_t));
+	for (int i = 0; i < r->sig_words; i++) r->sig[i] = rv32i_read_mem(core, RV32I_DMEM, t->begin + 4 * i);
+	rv32i_destroy(core);
+
+	if (!h.stored) r->result = HANG;
+	else if (t->ref_words < 0) r->result = NOREF;
+	else {
+		r->first_diff = -1;
+		for (int i = 0; i < r->sig_words || i < t->ref_words; i++) {
+			if (i >= r->sig_words || i >= t->ref_words || r->sig[i] != t->ref[i]) {
+				r->first_diff = i;
+				break;
+			}
+		}
+		r->result = (r->first_diff < 0) ? PASS : FAIL;
+	}
+}
+
+static void write_signature(const struct arch* a, const struct run* r)
+{
+	char path[1024];
+	snprintf(path, sizeof(path), "%s/%s.%s.signature", a->sig_dir, a->test[r->test].name, rv32i_engine_name(r->engine));
+	FILE* fp = fopen(path, "w");
+	if (!fp) {
+		fprintf(stderr, "Cannot create %s\n", path);
+		return;
+	}
+	for (int i = 0; i < r->sig_words; i++) fprintf(fp, "%08x\n", r->sig[i]);
+	fclose(fp);
+}
+
+static void* worker(void* arg)
+{
+	struct arch* a = (struct arch*)arg;
+
+	for (;;) {
+		pthread_mutex_lock(&a->lock);
+		int i = a->next++;
+		pthread_mutex_unlock(&a->lock);
+		if (i >= a->runs) return NULL;
+
+		execute(a, &a->run[i]);
+		if (a->sig_dir && a->run[i].sig) write_signature(a, &a->run[i]);
+	}
+}
+
+static void usage(const char* prog)
+{
+	printf("usage: %s [-j jobs] [-C config_file] [-e engine,...] [-c max_cycles] [-r reference_dir] [-s signature_dir] test...\n", prog);
+	printf("  test: an ELF built with arch/model_test.h and arch/link.ld, or a directory of them (*.elf)\n");
+	printf("  the reference of <name>.elf is <name>.reference_output, next to it or in the -r directory\n");
+	exit(1);
+}
+
+int main(int argc, char* argv[]) {
+
+	struct arch a = { 0 };
+	enum rv32i_engine engine[RV32I_ENGINE_NUM];
+	const char* ref_dir = NULL;
+	int engines = 0, jobs = (int)sysconf(_SC_NPROCESSORS_ONLN), opt, i, j;
+
+	// tests are larger than the RTL memories and must halt quickly
+	rv32i_config_init(&a.base, RV32I_SINGLE);
+	a.base.imem_depth = a.base.dmem_depth = 1 << 18;
+	a.base.max_cycles = 1000000;
+
+	// get input arguments
+	while ((opt = getopt(argc, argv, "j:C:e:c:r:s:")) != -1) {
+		switch (opt) {
+		case 'j': jobs = atoi(optarg); break;
+		case 'C':
+			if (rv32i_config_load(&a.base, optarg) < 0) {
+				fprintf(stderr, "Cannot read %s\n", optarg);
+				exit(1);
+			}
+			break;
+		case 'e':
+			for (char* v = strtok(optarg, ","); v; v = strtok(NULL, ",")) {
+				struct rv32i_config check;
+				rv32i_config_init(&check, RV32I_SINGLE);
+				if (engines == RV32I_ENGINE_NUM || rv32i_config_set(&check, "engine", v) < 0) usage(argv[0]);
+				engine[engines++] = check.engine;
+			}
+			break;
+		case 'c':
+			if (rv32i_config_set(&a.base, "max_cycles", optarg) < 0) usage(argv[0]);
+			break;
+		case 'r': ref_dir = optarg; break;
+		case 's': a.sig_dir = optarg; break;
+		default: usage(argv[0]); break;
+		}
+	}
+	if (optind == argc) usage(argv[0]);
+	if (!engines) {
+		for (engines = 0; engines < RV32I_ENGINE_NUM; engines++) engine[engines] = (enum rv32i_engine)engines;
+	}
+
+	a.test = (struct test*)calloc(TEST_MAX, sizeof(struct test));
+	for (i = optind; i < argc; i++) {
+		if (is_dir(argv[i])) add_dir(&a, argv[i], ref_dir);
+		else add_test(&a, argv[i], ref_dir);
+	}
+	if (!a.tests) {
+		fprintf(stderr, "No tests\n");
+		exit(1);
+	}
+
+	a.runs = a.tests * engines;
+	a.run = (struct run*)calloc(a.runs, sizeof(struct run));
+	for (i = 0; i < a.runs; i++) {
+		a.run[i].test = i / engines;
+		a.run[i].engine = engine[i % engines];
+	}
+
+	if (jobs > a.runs) jobs = a.runs;
+	if (jobs < 1) jobs = 1;
+	pthread_t* thread = (pthread_t*)calloc(jobs, sizeof(pthread_t));
+	pthread_mutex_init(&a.lock, NULL);
+	double t = now();
+	for (i = 0; i < jobs; i++) pthread_create(&thread[i], NULL, worker, &a);
+	for (i = 0; i < jobs; i++) pthread_join(thread[i], NULL);
+	t = now() - t;
+
+	// the matrix, then what failed
+	int width = 4, failed = 0;
+	for (i = 0; i < a.tests; i++) {
+		if ((int)strlen(a.test[i].name) > width) width = (int)strlen(a.test[i].name);
+	}
+	printf("%-*s", width, "test");
+	for (j = 0; j < engines; j++) printf((j + 1 < engines) ? "  %-8s" : "  %s", rv32i_engine_name(engine[j]));
+	printf("\n");
+	for (i = 0; i < a.tests; i++) {
+		printf("%-*s", width, a.test[i].name);
+		for (j = 0; j < engines; j++) printf((j + 1 < engines) ? "  %-8s" : "  %s", result_name[a.run[i * engines + j].result]);
+		printf("\n");
+	}
+	for (i = 0; i < a.runs; i++) {
+		const struct run* r = &a.run[i];
+		const struct test* te = &a.test[r->test];
+		const char* engine_name = rv32i_engine_name(r->engine);
+		if (r->result == PASS) continue;
+		failed++;
+		if (r->result == FAIL && r->first_diff < r->sig_words && r->first_diff < te->ref_words)
+			printf("%s on %s: signature word %d (%08x) is %08x, expected %08x\n", te->name, engine_name, r->first_diff,
+				te->begin + 4 * r->first_diff, r->sig[r->first_diff], te->ref[r->first_diff]);
+		else if (r->result == FAIL)
+			printf("%s on %s: signature has %d words, the reference %d\n", te->name, engine_name, r->sig_words, te->ref_words);
+		else if (r->result == HANG)
+			printf("%s on %s: no store to tohost in %llu cycles\n", te->name, engine_name, (unsigned long long)r->cycles);
+		else if (r->result == NOREF)
+			printf("%s on %s: no reference signature\n", te->name, engine_name);
+		else
+			printf("%s on %s: %s\n", te->name, engine_name, (r->error == RV32I_ERR_OPEN) ? "cannot open the ELF" :
+				(r->error == RV32I_ERR_RANGE) ? "doesn't fit in imem/dmem (raise imem_depth/dmem_depth of the -C config)" :
+				(r->error < 0) ? "not an RV32 ELF with begin_signature, end_signature and tohost" : "the engine doesn't support the config");
+	}
+	fprintf(stderr, "%d runs (%d tests x %d engines) on %d threads in %.3f s, %d failed\n", a.runs, a.tests, engines, jobs, t, failed);
+
+	for (i = 0; i < a.runs; i++) free(a.run[i].sig);
+	for (i = 0; i < a.tests; i++) {
+		free(a.test[i].elf);
+		free(a.test[i].name);
+		free(a.test[i].ref);
+	}
+	free(a.test);
+	free(a.run);
+	free(thread);
+	pthread_mutex_destroy(&a.lock);
+
+	return failed != 0;
+}
@@ -0,0 +1,520 @@
+/* **************************************
+ * Module: random instruction stream fuzzer
+ *
+ * - Generates RV32I programs dense in pipeline hazards: back-to-back
+ *   dependencies on a few registers, load-use pairs, lui results consumed
+ *   right away, branches and jumps to pc+4/pc+8 (the flush optimization),
+ *   jalr through registers just written, and the pairs the pipeline fuses
+ * - A program is a list of units (one instruction or a short idiom) ending
+ *   in a jump to itself; control flow only goes forward, to unit starts
+ * - Every program runs on the pipeline engine and on the single-cycle engine,
+ *   registers and dmem are compared after both reached the final jump
+ * - A failing program is shrunk by turning its units into nops (halving
+ *   chunks down to single units) and zeroing dmem words while it still fails,
+ *   then written as imem.mem/dmem.mem and the failing config to a directory
+ *   (a workload for rv32i_pipeline, rv32i_sweep and the RTL testbenches)
+ * - Program n is generated from seed + n, so any failure can be regenerated
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "librv32i.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define UNIT_MAX 128
+#define WORD_MAX 512		// keeps jump targets in the 12-bit immediate of addi
+#define DATA_WORDS 64		// dmem the programs load and store, from address 0
+#define REG_POOL 7			// x1-x7 (and x0) are used, so most instructions depend on a recent one
+#define NOP 0x00000013		// addi x0, x0, 0
+#define HALT 0x0000006f		// jal x0, 0
+
+struct prog {
+	uint32_t word[WORD_MAX];
+	int words;
+	int unit_start[UNIT_MAX + 1];	// word index of every unit, the last is the halt
+	int units;
+	uint32_t data[DATA_WORDS];
+};
+
+// a control transfer the layout patches once the units are placed
+struct fixup {
+	int word;			// instruction to patch
+	int base;			// word the offset is relative to
+	int target_unit;
+	uint8_t kind;		// FIX_*
+};
+
+enum { FIX_B, FIX_J, FIX_I_REL, FIX_I_ABS };
+
+struct fuzz {
+	uint64_t seed;
+	int programs;
+	int units;
+	int all_knobs;
+	const char* out_dir;
+	struct rv32i_config base;
+	int next;
+	int failed;
+	pthread_mutex_t lock;
+};
+
+static const char* const stage_name[] = { "IF", "ID", "EX", "MEM", "WB" };
+
+static uint32_t rnd(uint64_t* s)
+{
+	*s ^= *s << 13;
+	*s ^= *s >> 7;
+	*s ^= *s << 17;
+	return (uint32_t)(*s >> 16);
+}
+
+static uint32_t pick(uint64_t* s, uint32_t n)
+{
+	return rnd(s) % n;
+}
+
+// encoders of the instruction formats
+static uint32_t enc_r(uint32_t f7, uint32_t rs2, uint32_t rs1, uint32_t f3, uint32_t rd, uint32_t op)
+{
+	return (f7 << 25) | (rs2 << 20) | (rs1 << 15) | (f3 << 12) | (rd << 7) | op;
+}
+
+static uint32_t enc_i(int32_t imm, uint32_t rs1, uint32_t f3, uint32_t rd, uint32_t op)
+{
+	return ((uint32_t)imm << 20) | (rs1 << 15) | (f3 << 12) | (rd << 7) | op;
+}
+
+static uint32_t enc_s(int32_t imm, uint32_t rs2, uint32_t rs1, uint32_t f3)
+{
+	return (((uint32_t)imm >> 5 & 0x7f) << 25) | (rs2 << 20) | (rs1 << 15) | (f3 << 12) | (((uint32_t)imm & 0x1f) << 7) | 0x23;
+}
+
+static uint32_t enc_b(int32_t imm, uint32_t rs2, uint32_t rs1, uint32_t f3)
+{
+	uint32_t u = (uint32_t)imm;
+	return ((u >> 12 & 1) << 31) | ((u >> 5 & 0x3f) << 25) | (rs2 << 20) | (rs1 << 15) | (f3 << 12) | ((u >> 1 & 0xf) << 8) | ((u >> 11 & 1) << 7) | 0x63;
+}
+
+static uint32_t enc_j(int32_t imm, uint32_t rd)
+{
+	uint32_t u = (uint32_t)imm;
+	return ((u >> 20 & 1) << 31) | ((u >> 1 & 0x3ff) << 21) | ((u >> 11 & 1) << 20) | ((u >> 12 & 0xff) << 12) | (rd << 7) | 0x6f;
+}
+
+// registers: mostly the last ones written, so the next instruction depends on them
+struct gen {
+	uint64_t s;
+	struct prog* p;
+	struct fixup fix[UNIT_MAX];
+	int fixes;
+	uint32_t recent[2];
+};
+
+static uint32_t src(struct gen* g)
+{
+	uint32_t r = pick(&g->s, 8);
+	if (r < 4) return g->recent[r & 1];
+	return (r == 4) ? 0 : 1 + pick(&g->s, REG_POOL);
+}
+
+static uint32_t dst_reg(struct gen* g, uint32_t rd)
+{
+	g->recent[1] = g->recent[0];
+	g->recent[0] = rd;
+	return rd;
+}
+
+static uint32_t dst(struct gen* g)
+{
+	return dst_reg(g, pick(&g->s, 16) ? 1 + pick(&g->s, REG_POOL) : 0);
+}
+
+// the base of a jalr or a pc-relative access, x0 would send it elsewhere
+static uint32_t dst_base(struct gen* g)
+{
+	return dst_reg(g, 1 + pick(&g->s, REG_POOL));
+}
+
+static void emit(struct gen* g, uint32_t word)
+{
+	g->p->word[g->p->words++] = word;
+}
+
+// a branch or jump target: the unit after this one, or one or two further (pc+4, pc+8 for one-word units)
+static void fix(struct gen* g, uint8_t kind, int base)
+{
+	struct fixup* f = &g->fix[g->fixes++];
+	f->word = g->p->words - 1;
+	f->base = base;
+	f->target_unit = g->p->units + 1 + pick(&g->s, 3);
+	f->kind = kind;
+}
+
+static uint32_t alu_r(struct gen* g, uint32_t rd, uint32_t rs1, uint32_t rs2)
+{
+	static const uint8_t f3[] = { 0, 0, 1, 2, 3, 4, 5, 5, 6, 7 };
+	int i = pick(&g->s, 10);
+	return enc_r((i == 1 || i == 7) ? 0x20 : 0, rs2, rs1, f3[i], rd, 0x33);	// sub, sra
+}
+
+static uint32_t alu_i(struct gen* g, uint32_t rd, uint32_t rs1)
+{
+	static const uint8_t f3[] = { 0, 2, 3, 4, 6, 7, 1, 5, 5 };
+	int i = pick(&g->s, 9);
+	if (i >= 6) return enc_i((int32_t)pick(&g->s, 32) | ((i == 8) ? 0x400 : 0), rs1, f3[i], rd, 0x13);	// slli, srli, srai
+	return enc_i((int32_t)pick(&g->s, 4096) - 2048, rs1, f3[i], rd, 0x13);
+}
+
+static uint32_t data_off(struct gen* g, uint32_t f3)
+{
+	uint32_t off = pick(&g->s, DATA_WORDS * 4);
+	return (f3 == 2) ? off & ~3u : (f3 == 1 || f3 == 5) ? off & ~1u : off;
+}
+
+static void gen_unit(struct gen* g)
+{
+	static const uint8_t load_f3[] = { 0, 1, 2, 4, 5 };
+	uint32_t rd, rs1, rs2, ra, f3;
+	int here = g->p->words;
+
+	switch (pick(&g->s, 16))
+	{
+	case 0: case 1: case 2:	// reg-reg
+		rs1 = src(g), rs2 = src(g);
+		emit(g, alu_r(g, dst(g), rs1, rs2));
+		break;
+	case 3: case 4:			// reg-imm
+		rs1 = src(g);
+		emit(g, alu_i(g, dst(g), rs1));
+		break;
+	case 5:					// lui or auipc, consumed right away half the time
+		rd = dst(g);
+		emit(g, (rnd(&g->s) & 0xfffff000) | (rd << 7) | (pick(&g->s, 2) ? 0x37 : 0x17));
+		if (pick(&g->s, 2)) {
+			rs2 = src(g);
+			emit(g, alu_r(g, dst(g), rd, rs2));
+		}
+		break;
+	case 6:					// load, used right away half the time
+		f3 = load_f3[pick(&g->s, 5)];
+		rd = dst(g);
+		emit(g, enc_i((int32_t)data_off(g, f3), 0, f3, rd, 0x03));
+		if (pick(&g->s, 2)) {
+			rs1 = src(g);
+			emit(g, alu_r(g, dst(g), rs1, rd));
+		}
+		break;
+	case 7:					// store, loaded back half the time
+		f3 = pick(&g->s, 3);
+		rs1 = data_off(g, f3);
+		rs2 = src(g);
+		emit(g, enc_s((int32_t)rs1, rs2, 0, f3));
+		if (pick(&g->s, 2)) emit(g, enc_i((int32_t)(rs1 & ~3u), 0, 2, dst(g), 0x03));
+		break;
+	case 8: case 9:			// conditional branch
+		rs1 = src(g), rs2 = src(g);
+		emit(g, enc_b(0, rs2, rs1, (uint32_t[]){ 0, 1, 4, 5, 6, 7 }[pick(&g->s, 6)]));
+		fix(g, FIX_B, here);
+		break;
+	case 10:				// jal
+		emit(g, enc_j(0, dst(g)));
+		fix(g, FIX_J, here);
+		break;
+	case 11:				// auipc + jalr (fuses when rd matches), or auipc + lw/sw
+		ra = dst_base(g);
+		emit(g, (ra << 7) | 0x17);
+		if (pick(&g->s, 2)) {
+			emit(g, enc_i(0, ra, 0, pick(&g->s, 2) ? ra : dst(g), 0x67));
+			fix(g, FIX_I_REL, here);
+		}
+		else {
+			int32_t off = (int32_t)(pick(&g->s, DATA_WORDS) * 4) - here * 4;
+			if (pick(&g->s, 2)) emit(g, enc_i(off, ra, 2, ra, 0x03));
+			else emit(g, enc_s(off, src(g), ra, 2));
+		}
+		break;
+	case 12:				// jalr through a register written just before, by addi or lui + addi
+		ra = dst_base(g);
+		if (pick(&g->s, 2)) emit(g, (ra << 7) | 0x37);
+		emit(g, enc_i(0, (g->p->words > here) ? ra : 0, 0, ra, 0x13));
+		fix(g, FIX_I_ABS, here);
+		emit(g, enc_i(0, ra, 0, dst(g), 0x67));
+		break;
+	case 13:				// lui + addi (fuses)
+		rd = dst(g);
+		emit(g, (rnd(&g->s) & 0xfffff000) | (rd << 7) | 0x37);
+		emit(g, enc_i((int32_t)pick(&g->s, 4096) - 2048, rd, 0, rd, 0x13));
+		break;
+	case 14:				// slli + srli by the same amount (fuses)
+		rs1 = src(g), rd = dst(g), f3 = pick(&g->s, 32);
+		emit(g, enc_i((int32_t)f3, rs1, 1, rd, 0x13));
+		emit(g, enc_i((int32_t)f3, rd, 5, rd, 0x13));
+		break;
+	default:				// a run of dependent instructions
+		for (int i = 0; i < 3; i++) {
+			rs1 = src(g), rs2 = src(g);
+			emit(g, alu_r(g, dst(g), rs1, rs2));
+		}
+		break;
+	}
+}
+
+static void generate(struct prog* p, uint64_t seed, int units)
+{
+	struct gen g = { seed * 0x9e3779b97f4a7c15ULL | 1, p, { { 0 } }, 0, { 1, 2 } };
+
+	memset(p, 0, sizeof(*p));
+	for (int i = 0; i < DATA_WORDS; i++) p->data[i] = pick(&g.s, 4) ? rnd(&g.s) * 0x10001u : pick(&g.s, 8);
+	for (p->units = 0; p->units < units && p->words + 4 < WORD_MAX; p->units++) {
+		p->unit_start[p->units] = p->words;
+		gen_unit(&g);
+	}
+	p->unit_start[p->units] = p->words;
+	emit(&g, HALT);
+
+	// control flow lands on unit starts, past the end it lands on the halt
+	for (int i = 0; i < g.fixes; i++) {
+		struct fixup* f = &g.fix[i];
+		int target = p->unit_start[(f->target_unit < p->units) ? f->target_unit : p->units] * 4;
+		uint32_t* w = &p->word[f->word];
+		int32_t off = target - f->base * 4;
+		if (f->kind == FIX_B) *w = enc_b(off, *w >> 20 & 0x1f, *w >> 15 & 0x1f, *w >> 12 & 0x7);
+		else if (f->kind == FIX_J) *w = enc_j(off, *w >> 7 & 0x1f);
+		else *w = (*w & 0xfffff) | ((uint32_t)((f->kind == FIX_I_REL) ? off : target) << 20);
+	}
+}
+
+static rv32i_core* run(const struct prog* p, const struct rv32i_config* cfg, uint64_t cycles)
+{
+	rv32i_core* core = rv32i_create_config(cfg);
+	rv32i_load_words(core, RV32I_IMEM, p->word, p->words);
+	rv32i_load_words(core, RV32I_DMEM, p->data, DATA_WORDS);
+	rv32i_step(core, cycles);
+	return core;
+}
+
+// 1 if the pipeline differs from the single-cycle engine (why says how), 0 if not,
+// -1 if the program doesn't reach its halt on the single-cycle engine (a shrink broke its control flow)
+static int check(const struct prog* p, const struct rv32i_config* cfg, char* why, size_t len)
+{
+	struct rv32i_config ref_cfg = *cfg;
+	uint32_t halt = (p->words - 1) * 4;
+	int ret = 0;
+
+	ref_cfg.engine = RV32I_SINGLE;
+	rv32i_core* ref = run(p, &ref_cfg, p->words + 1);	// forward only: every word at most once
+	if (rv32i_get_pc(ref) != halt) {
+		rv32i_destroy(ref);
+		return -1;
+	}
+	rv32i_core* core = run(p, cfg, 4 * p->words + 64);
+
+	uint32_t pc = rv32i_get_pc(core);
+	if (pc < halt || pc > halt + 16) {	// fetch goes on past the halt until it is resolved
+		snprintf(why, len, "the pipeline is at pc %08x, not at the final jump (%08x)", pc, halt);
+		ret = 1;
+	}
+	for (int i = 1; i < 32 && !ret; i++) {
+		if (rv32i_get_reg(core, i) == rv32i_get_reg(ref, i)) continue;
+		snprintf(why, len, "x%d is %08x on the pipeline, %08x on the single-cycle engine", i, rv32i_get_reg(core, i), rv32i_get_reg(ref, i));
+		ret = 1;
+	}
+	for (uint32_t a = 0; a < cfg->dmem_depth * 4 && !ret; a += 4) {
+		if (rv32i_read_mem(core, RV32I_DMEM, a) == rv32i_read_mem(ref, RV32I_DMEM, a)) continue;
+		snprintf(why, len, "dmem[%08x] is %08x on the pipeline, %08x on the single-cycle engine", a,
+			rv32i_read_mem(core, RV32I_DMEM, a), rv32i_read_mem(ref, RV32I_DMEM, a));
+		ret = 1;
+	}
+	rv32i_destroy(core);
+	rv32i_destroy(ref);
+	return ret;
+}
+
+// nops units (in chunks halving down to one) and zeroes dmem words for as long as the program keeps failing
+static void shrink(struct prog* p, const struct rv32i_config* cfg)
+{
+	struct prog t;
+	char why[128];
+	int u, i, chunk, progress;
+
+	for (chunk = p->units / 2; chunk >= 1; chunk = progress ? chunk : chunk / 2) {
+		progress = 0;
+		for (u = 0; u < p->units; u += chunk) {
+			int end = (u + chunk < p->units) ? u + chunk : p->units;
+			int changed = 0;
+			t = *p;
+			for (i = t.unit_start[u]; i < t.unit_start[end]; i++) {
+				changed |= (t.word[i] != NOP);
+				t.word[i] = NOP;
+			}
+			if (changed && check(&t, cfg, why, sizeof(why)) == 1) {
+				*p = t;
+				progress = 1;
+			}
+		}
+	}
+	for (i = 0; i < DATA_WORDS; i++) {
+		if (!p->data[i]) continue;
+		t = *p;
+		t.data[i] = 0;
+		if (check(&t, cfg, why, sizeof(why)) == 1) *p = t;
+	}
+}
+
+static int save(const struct prog* p, const struct rv32i_config* cfg, const char* dir)
+{
+	char path[1024];
+	FILE* fp;
+
+	mkdir(dir, 0777);
+	if (snprintf(path, sizeof(path), "%s/imem.mem", dir) >= (int)sizeof(path) || !(fp = fopen(path, "w"))) return -1;
+	for (int i = 0; i < p->words; i++) {
+		for (int b = 31; b >= 0; b--) fputc('0' + (p->word[i] >> b & 1), fp);
+		fputc('\n', fp);
+	}
+	fclose(fp);
+	if (snprintf(path, sizeof(path), "%s/dmem.mem", dir) >= (int)sizeof(path) || !(fp = fopen(path, "w"))) return -1;
+	for (int i = 0; i < DATA_WORDS; i++) fprintf(fp, "%08x\n", p->data[i]);
+	fclose(fp);
+	if (snprintf(path, sizeof(path), "%s/config", dir) >= (int)sizeof(path) || !(fp = fopen(path, "w"))) return -1;
+	rv32i_config_write(cfg, fp);
+	fclose(fp);
+	return 0;
+}
+
+static int count_live(const struct prog* p)
+{
+	int n = 0;
+	for (int i = 0; i < p->words; i++) n += (p->word[i] != NOP);
+	return n;
+}
+
+// the knob combinations a program runs on: the base config, or every forwarding/flush_opt/branch_stage/fusion point
+static int points(const struct fuzz* fz, struct rv32i_config* cfg)
+{
+	if (!fz->all_knobs) {
+		cfg[0] = fz->base;
+		return 1;
+	}
+	int n = 0;
+	for (int k = 0; k < 24; k++, n++) {
+		cfg[n] = fz->base;
+		cfg[n].forwarding = k & 1;
+		cfg[n].flush_opt = k >> 1 & 1;
+		cfg[n].fusion = k >> 2 & 1;
+		cfg[n].branch_stage = RV32I_STAGE_ID + k / 8;
+	}
+	return n;
+}
+
+static void* worker(void* arg)
+{
+	struct fuzz* fz = (struct fuzz*)arg;
+	struct prog* orig = (struct prog*)malloc(sizeof(struct prog));
+	struct prog* p = (struct prog*)malloc(sizeof(struct prog));
+	struct rv32i_config cfg[24];
+	int n = points(fz, cfg);
+	char why[128], dir[1024];
+
+	for (;;) {
+		pthread_mutex_lock(&fz->lock);
+		int i = fz->next++;
+		pthread_mutex_unlock(&fz->lock);
+		if (i >= fz->programs) break;
+
+		uint64_t seed = fz->seed + i;
+		generate(orig, seed, fz->units);
+		for (int k = 0; k < n; k++) {
+			*p = *orig;
+			int ret = check(p, &cfg[k], why, sizeof(why));
+			if (ret < 0) {
+				pthread_mutex_lock(&fz->lock);
+				printf("seed %llu: the program doesn't reach its final jump on the single-cycle engine\n", (unsigned long long)seed);
+				fz->failed++;
+				pthread_mutex_unlock(&fz->lock);
+				break;
+			}
+			if (!ret) continue;
+
+			int live = count_live(p);
+			shrink(p, &cfg[k]);
+			check(p, &cfg[k], why, sizeof(why));
+			snprintf(dir, sizeof(dir), "%s/%llu", fz->out_dir, (unsigned long long)seed);
+			pthread_mutex_lock(&fz->lock);
+			printf("seed %llu (forwarding %u, flush_opt %u, branch_stage %s, fusion %u): %s; shrunk from %d to %d instructions, %s %s\n",
+				(unsigned long long)seed, cfg[k].forwarding, cfg[k].flush_opt, stage_name[cfg[k].branch_stage], cfg[k].fusion, why,
+				live, count_live(p), (save(p, &cfg[k], dir) < 0) ? "cannot write" : "written to", dir);
+			fflush(stdout);
+			fz->failed++;
+			pthread_mutex_unlock(&fz->lock);
+			break;	// one report per program
+		}
+	}
+	free(orig);
+	free(p);
+	return NULL;
+}
+
+static void usage(const char* prog)
+{
+	printf("usage: %s [-j jobs] [-n programs] [-s seed] [-u units] [-k] [-C config_file] [-o fail_dir]\n", prog);
+	printf("  -k runs every program on all forwarding/flush_opt/branch_stage/fusion combinations\n");
+	exit(1);
+}
+
+int main(int argc, char* argv[]) {
+
+	struct fuzz fz = { 0 };
+	int jobs = (int)sysconf(_SC_NPROCESSORS_ONLN), opt, i;
+
+	fz.seed = 1;
+	fz.programs = 10000;
+	fz.units = 48;
+	fz.out_dir = "fuzz_fail";
+	rv32i_config_init(&fz.base, RV32I_PIPELINE);
+
+	// get input arguments
+	while ((opt = getopt(argc, argv, "j:n:s:u:kC:o:")) != -1) {
+		switch (opt) {
+		case 'j': jobs = atoi(optarg); break;
+		case 'n': fz.programs = atoi(optarg); break;
+		case 's': fz.seed = strtoull(optarg, NULL, 0); break;
+		case 'u': fz.units = atoi(optarg); break;
+		case 'k': fz.all_knobs = 1; break;
+		case 'C':
+			if (rv32i_config_load(&fz.base, optarg) < 0) {
+				fprintf(stderr, "Cannot read %s\n", optarg);
+				exit(1);
+			}
+			break;
+		case 'o': fz.out_dir = optarg; break;
+		default: usage(argv[0]); break;
+		}
+	}
+	if (optind != argc || fz.units < 1 || fz.units > UNIT_MAX) usage(argv[0]);
+	fz.base.engine = RV32I_PIPELINE;
+	if (fz.base.dmem_depth < DATA_WORDS || fz.base.imem_depth < WORD_MAX) {
+		fprintf(stderr, "The programs need imem_depth %d and dmem_depth %d\n", WORD_MAX, DATA_WORDS);
+		exit(1);
+	}
+	if (jobs < 1) jobs = 1;
+	if (jobs > fz.programs) jobs = fz.programs;
+	mkdir(fz.out_dir, 0777);
+
+	pthread_t* thread = (pthread_t*)calloc(jobs, sizeof(pthread_t));
+	pthread_mutex_init(&fz.lock, NULL);
+	for (i = 0; i < jobs; i++) pthread_create(&thread[i], NULL, worker, &fz);
+	for (i = 0; i < jobs; i++) pthread_join(thread[i], NULL);
+	pthread_mutex_destroy(&fz.lock);
+	free(thread);
+
+	fprintf(stderr, "%d programs from seed %llu on %d threads, %d failed\n", fz.programs, (unsigned long long)fz.seed, jobs, fz.failed);
+	if (!fz.failed) rmdir(fz.out_dir);
+	return fz.failed != 0;
+}
@@ -0,0 +1,141 @@
+/* **************************************
+ * Module: ELF runner
+ *
+ * - Loads an RV32 ELF program and runs it on one of the librv32i engines
+ *   until it calls exit (newlib syscalls are proxied to the host, see librv32i/syscall.c)
+ * - The program's console output goes to stdout, the run summary and the
+ *   engine's statistics (rv32i_report) to stderr
+ * - Exits with the program's exit code
+ * - -p N prints the N hottest pcs and the functions (ELF symbols) after the run,
+ *   -f file writes the call stacks in folded format (flamegraph.pl input)
+ * - -k file writes a Konata pipeline log of the pipeline engine
+ * - -C file reads an rv32i_config (memory sizes, clock count, pipeline knobs),
+ *   -e and -c override it
+ * - -g address runs the program under gdb instead ("target remote" to
+ *   "[host]:port" or "unix::path"), the clock count doesn't apply
+ * - -r KiB keeps an undo log of that size for gdb's reverse-step and
+ *   reverse-continue (single engine, see librv32i/undo.c)
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "librv32i.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+int main(int argc, char* argv[]) {
+
+	struct rv32i_config cfg;
+	const char* sandbox = NULL;
+	const char* folded = NULL;
+	const char* konata = NULL;
+	const char* gdb_address = NULL;
+	int opt, err, code = 0, top = 0, bad = 0, undo_kib = 0;
+
+	rv32i_config_init(&cfg, RV32I_SINGLE);
+
+	// get input arguments
+	while ((opt = getopt(argc, argv, "C:e:c:d:p:f:k:g:r:")) != -1) {
+		switch (opt) {
+		case 'C':
+			if ((err = rv32i_config_load(&cfg, optarg)) < 0) {
+				fprintf(stderr, (err == RV32I_ERR_OPEN) ? "Cannot find %s\n" : "Bad line in %s\n", optarg);
+				bad = 1;
+			}
+			break;
+		case 'e': bad |= (rv32i_config_set(&cfg, "engine", optarg) < 0); break;
+		case 'c': bad |= (rv32i_config_set(&cfg, "max_cycles", optarg) < 0); break;
+		case 'd': sandbox = optarg; break;
+		case 'p': top = atoi(optarg); break;
+		case 'f': folded = optarg; break;
+		case 'k': konata = optarg; break;
+		case 'g': gdb_address = optarg; break;
+		case 'r': undo_kib = atoi(optarg); break;
+		default: optind = argc + 1; break;
+		}
+	}
+	if (argc - optind != 1 || bad) {
+		printf("usage: %s [-C config_file] [-e single|pipeline] [-c clock_count] [-d sandbox_dir] [-p top_count] [-f folded_file] [-k konata_file] [-g [host]:port|socket_path [-r undo_log_kib]] program.elf\n", argv[0]);
+		exit(1);
+	}
+
+	rv32i_core* core = rv32i_create_config(&cfg);
+	if (!core) {
+		fprintf(stderr, "The %s engine doesn't support this configuration\n", rv32i_engine_name(cfg.engine));
+		exit(1);
+	}
+	int ret = rv32i_load_elf(core, argv[optind]);
+	if (ret < 0) {
+		fprintf(stderr, (ret == RV32I_ERR_OPEN) ? "Cannot find %s\n" : (ret == RV32I_ERR_RANGE) ?
+			"%s doesn't fit in imem/dmem (raise imem_depth/dmem_depth of the -C config)\n" : "%s isn't an RV32 ELF\n", argv[optind]);
+		exit(1);
+	}
+	rv32i_sys* sys = rv32i_sys_create(core, sandbox, stdout);
+	rv32i_prof* prof = NULL;
+	if (top > 0 || folded) {
+		prof = rv32i_prof_create(core);
+		if (rv32i_prof_load_symbols(prof, argv[optind]) <= 0) fprintf(stderr, "%s has no symbols, profiling by pc only\n", argv[optind]);
+	}
+	FILE* view_fp = NULL;
+	rv32i_view* view = NULL;
+	if (konata) {
+		if ((view_fp = fopen(konata, "w")) == NULL) {
+			fprintf(stderr, "Cannot create %s\n", konata);
+			exit(1);
+		}
+		view = rv32i_view_create(core, view_fp);
+	}
+
+	uint64_t cycles;
+	if (gdb_address) {
+		rv32i_gdb* gdb = rv32i_gdb_create(core, gdb_address);
+		if (!gdb) {
+			fprintf(stderr, "Cannot serve gdb on %s (single and pipeline engines only)\n", gdb_address);
+			exit(1);
+		}
+		rv32i_undo* undo = NULL;
+		if (undo_kib > 0 && (undo = rv32i_undo_create(core, (uint32_t)undo_kib << 10, 0)) == NULL) {
+			fprintf(stderr, "Cannot run the %s engine backwards (single engine only)\n", rv32i_engine_name(cfg.engine));
+			exit(1);
+		}
+		fprintf(stderr, "waiting for gdb on %s\n", gdb_address);
+		rv32i_gdb_serve(gdb);
+		rv32i_gdb_destroy(gdb);
+		rv32i_undo_destroy(undo);
+		cycles = rv32i_get_cycles(core);
+	}
+	else cycles = rv32i_step(core, cfg.max_cycles);
+	rv32i_sys_flush(sys);
+
+	if (rv32i_sys_exited(sys, &code)) fprintf(stderr, "\nexit code %d", code);
+	else fprintf(stderr, "\n%s", rv32i_halted(core) ? "halted by ebreak" : "clock count reached");
+	fprintf(stderr, " after %llu cycles, %llu instructions retired, pc %08X\n", (unsigned long long)cycles,
+		(unsigned long long)rv32i_get_retired(core), rv32i_get_pc(core));
+	if (rv32i_sys_unknown(sys)) fprintf(stderr, "%llu unsupported syscalls\n", (unsigned long long)rv32i_sys_unknown(sys));
+	rv32i_report(core, stderr);	// the engine's own statistics, if it keeps any
+	rv32i_host_report(core, stderr);	// host time per stage, librv32i built with -DHOST_PROF
+
+	if (prof) {
+		if (top > 0) rv32i_prof_report(prof, stderr, top);
+		if (folded) {
+			FILE* fp = fopen(folded, "w");
+			if (fp) {
+				rv32i_prof_folded(prof, fp);
+				fclose(fp);
+			}
+			else fprintf(stderr, "Cannot create %s\n", folded);
+		}
+		rv32i_prof_destroy(prof);
+	}
+	if (view) {
+		rv32i_view_destroy(view);
+		fclose(view_fp);
+	}
+	rv32i_sys_destroy(sys);
+	rv32i_destroy(core);
+
+	return code;
+}
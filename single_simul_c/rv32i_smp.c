@@ -0,0 +1,99 @@
+/* **************************************
+ * Module: multi-hart rv32i functional simulator
+ *
+ * - N single-cycle harts sharing one dmem, one host thread per hart (see librv32i/smp.c)
+ * - Every hart runs the same program, a0 holds its hart id
+ * - -s runs 1, 2, 4, ... harts and reports how the aggregate MIPS scales
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "librv32i.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define CLK_NUM 1000000000	// harts normally halt long before
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// run harts harts on the image, returns the aggregate MIPS
+static double run(const char* imem_file, const char* dmem_file, int harts, uint64_t clk_num, uint64_t quantum, int deterministic, int show)
+{
+	rv32i_smp* smp = rv32i_smp_create(harts);
+	int h;
+
+	if (rv32i_smp_load_image(smp, imem_file, dmem_file) < 0) {
+		printf("Cannot read %s or %s\n", imem_file, dmem_file);
+		exit(1);
+	}
+	if (quantum) rv32i_smp_set_quantum(smp, quantum);
+	rv32i_smp_set_deterministic(smp, deterministic);
+
+	double t = now();
+	uint64_t retired = rv32i_smp_run(smp, clk_num);
+	t = now() - t;
+
+	if (show) {
+		for (h = 0; h < harts; h++) {
+			rv32i_core* core = rv32i_smp_hart(smp, h);
+			printf("hart %d: %llu instructions in %llu cycles, %s, pc %08X\n", h, (unsigned long long)rv32i_get_retired(core),
+				(unsigned long long)rv32i_get_cycles(core), rv32i_smp_halted(smp, h) ? "halted" : "running", rv32i_get_pc(core));
+		}
+		rv32i_show_state(rv32i_smp_hart(smp, 0));
+		printf("\n%d harts (%s): %llu instructions in %.3f s, %.2f MIPS\n", harts, deterministic ? "deterministic" : "threaded",
+			(unsigned long long)retired, t, retired / t * 1e-6);
+	}
+
+	rv32i_smp_destroy(smp);
+	return retired / t * 1e-6;
+}
+
+int main(int argc, char* argv[]) {
+
+	int harts = 2, deterministic = 0, scaling = 0, opt;
+	uint64_t clk_num = CLK_NUM, quantum = 0;
+
+	// get input arguments
+	while ((opt = getopt(argc, argv, "n:c:q:ds")) != -1) {
+		switch (opt) {
+		case 'n': harts = atoi(optarg); break;
+		case 'c': clk_num = strtoull(optarg, NULL, 0); break;
+		case 'q': quantum = strtoull(optarg, NULL, 0); break;
+		case 'd': deterministic = 1; break;
+		case 's': scaling = 1; break;
+		default: optind = argc + 1; break;
+		}
+	}
+	if (argc - optind != 2 || harts < 1) {
+		printf("usage: %s [-n harts] [-c clock_count] [-q quantum] [-d] [-s] imem_data_file dmem_data_file\n", argv[0]);
+		printf("  -d  deterministic: harts run round-robin on one host thread\n");
+		printf("  -s  scaling: run 1, 2, 4, ... up to the given number of harts\n");
+		exit(1);
+	}
+
+	if (!scaling) {
+		run(argv[optind], argv[optind + 1], harts, clk_num, quantum, deterministic, 1);
+		return 0;
+	}
+
+	printf("%ld host cores\n", sysconf(_SC_NPROCESSORS_ONLN));
+	printf("%6s %12s %10s %10s\n", "harts", "MIPS", "speedup", "per hart");
+	double base = 0;
+	for (int n = 1; ; n = (n * 2 > harts && n < harts) ? harts : n * 2) {
+		double mips = run(argv[optind], argv[optind + 1], n, clk_num, quantum, deterministic, 0);
+		if (n == 1) base = mips;
+		printf("%6d %12.2f %9.2fx %10.2f\n", n, mips, mips / base, mips / n);
+		if (n >= harts) break;
+	}
+
+	return 0;
+}
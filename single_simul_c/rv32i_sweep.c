@@ -0,0 +1,298 @@
+/* **************************************
+ * Module: design-space sweep runner
+ *
+ * - Runs every workload on every point of the cross-product of the -p
+ *   parameter lists (rv32i_config keys), on a pool of host threads
+ * - A workload is an RV32 ELF (runs until exit, syscalls proxied with the
+ *   console discarded) or a directory with imem.mem and dmem.mem (runs until
+ *   the pc has left the program and the instructions in flight have retired,
+ *   the statistics end at the last retirement)
+ * - Every point is checked against the single-cycle engine with the same
+ *   memory sizes: registers, dmem and exit code
+ * - Writes a tab-separated table, one row per run, in point order
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "librv32i.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define PARAM_MAX 16
+#define VALUE_MAX 32
+#define QUIET_CYCLES 64	// image workloads: cycles without a retirement after the pc left the program, when the count to reach is unknown
+
+struct param {
+	char* key;
+	char* value[VALUE_MAX];
+	int values;
+};
+
+struct run {
+	int workload;
+	struct rv32i_config cfg;
+	int point;
+	// results
+	int error;			// RV32I_ERR_* of loading
+	struct rv32i_stats stats;
+	int exited, code;
+	int match;			// -1: not checked (single-cycle point)
+	double seconds;
+};
+
+struct sweep {
+	char** workload;
+	int workloads;
+	struct param param[PARAM_MAX];
+	int params;
+	struct run* run;
+	int runs;
+	int next;			// next run to be taken by a worker
+	pthread_mutex_t lock;
+};
+
+struct drain {
+	uint32_t end;		// byte address past the program
+	uint64_t target;	// instructions the single-cycle engine retired, 0: unknown
+	uint64_t retired;
+	struct rv32i_stats stats;	// at the last retirement
+	uint64_t quiet;
+};
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int is_dir(const char* path)
+{
+	struct stat st;
+	return stat(path, &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+// the single-cycle engine has nothing in flight, the others are done once they have retired as much
+static int drained(rv32i_core* core, void* arg)
+{
+	struct drain* d = (struct drain*)arg;
+	if (rv32i_get_retired(core) != d->retired) {
+		d->retired = rv32i_get_retired(core);
+		rv32i_get_stats(core, &d->stats);
+		d->quiet = 0;
+	}
+	if (rv32i_get_pc(core) < d->end) return 0;
+	if (rv32i_get_config(core)->engine == RV32I_SINGLE || (d->target && d->retired >= d->target)) return 1;
+	return ++d->quiet >= QUIET_CYCLES;
+}
+
+// runs a workload on a fresh core, returns it for the comparison (rv32i_destroy() it) or NULL;
+// target: instructions an image workload retires on the single-cycle engine, 0: unknown
+static rv32i_core* execute(const char* workload, const struct rv32i_config* cfg, struct run* r, uint64_t target)
+{
+	rv32i_core* core = rv32i_create_config(cfg);
+	if (!core) {
+		r->error = RV32I_ERR_RANGE;
+		return NULL;
+	}
+
+	if (is_dir(workload)) {
+		char imem_file[1024], dmem_file[1024];
+		snprintf(imem_file, sizeof(imem_file), "%s/imem.mem", workload);
+		snprintf(dmem_file, sizeof(dmem_file), "%s/dmem.mem", workload);
+		int n = rv32i_load_file(core, RV32I_IMEM, imem_file);
+		if (n < 0 || (r->error = rv32i_load_file(core, RV32I_DMEM, dmem_file)) < 0) {
+			if (n < 0) r->error = n;
+			rv32i_destroy(core);
+			return NULL;
+		}
+		r->error = 0;
+
+		struct drain d = { (uint32_t)n << 2, target, 0, { 0 }, 0 };
+		rv32i_run_until(core, drained, &d, cfg->max_cycles);
+		r->stats = d.stats;	// the drain isn't part of the program
+		return core;
+	}
+
+	if ((r->error = rv32i_load_elf(core, workload)) < 0) {
+		rv32i_destroy(core);
+		return NULL;
+	}
+	FILE* null = fopen("/dev/null", "w");
+	rv32i_sys* sys = rv32i_sys_create(core, NULL, null);
+	rv32i_step(core, cfg->max_cycles);
+	rv32i_get_stats(core, &r->stats);
+	r->exited = rv32i_sys_exited(sys, &r->code);
+	rv32i_sys_destroy(sys);
+	fclose(null);
+	return core;
+}
+
+static int same_state(rv32i_core* a, rv32i_core* b, const struct rv32i_config* cfg)
+{
+	for (int i = 1; i < 32; i++) {
+		if (rv32i_get_reg(a, i) != rv32i_get_reg(b, i)) return 0;
+	}
+	for (uint32_t i = 0; i < cfg->dmem_depth; i++) {
+		if (rv32i_read_mem(a, RV32I_DMEM, i << 2) != rv32i_read_mem(b, RV32I_DMEM, i << 2)) return 0;
+	}
+	return 1;
+}
+
+static void* worker(void* arg)
+{
+	struct sweep* sw = (struct sweep*)arg;
+
+	for (;;) {
+		pthread_mutex_lock(&sw->lock);
+		int i = sw->next++;
+		pthread_mutex_unlock(&sw->lock);
+		if (i >= sw->runs) return NULL;
+
+		struct run* r = &sw->run[i];
+		const char* workload = sw->workload[r->workload];
+		rv32i_core* ref_core = NULL;
+		struct run ref = { 0 };
+		if (r->cfg.engine != RV32I_SINGLE) {	// the reference runs first, it tells the point how much to retire
+			struct rv32i_config ref_cfg = r->cfg;
+			ref_cfg.engine = RV32I_SINGLE;
+			ref_core = execute(workload, &ref_cfg, &ref, 0);
+		}
+		double t = now();
+		rv32i_core* core = execute(workload, &r->cfg, r, ref_core ? ref.stats.retired : 0);
+		r->seconds = now() - t;
+		r->match = -1;
+		if (core && r->cfg.engine != RV32I_SINGLE) {
+			r->match = ref_core && ref.exited == r->exited && ref.code == r->code && same_state(core, ref_core, &r->cfg);
+		}
+		if (ref_core) rv32i_destroy(ref_core);
+		if (core) rv32i_destroy(core);
+	}
+}
+
+static void usage(const char* prog)
+{
+	printf("usage: %s [-j jobs] [-C config_file] [-o results_file] [-p key=value,value,...]... workload...\n", prog);
+	printf("  workload: an RV32 ELF, or a directory with imem.mem and dmem.mem\n");
+	printf("  keys: engine, imem_depth, dmem_depth, max_cycles, byte_lanes, forwarding, flush_opt, branch_stage, fusion\n");
+	exit(1);
+}
+
+int main(int argc, char* argv[]) {
+
+	struct sweep sw = { 0 };
+	struct rv32i_config base;
+	const char* results = NULL;
+	int jobs = (int)sysconf(_SC_NPROCESSORS_ONLN), opt, i, j;
+
+	rv32i_config_init(&base, RV32I_PIPELINE);
+
+	// get input arguments
+	while ((opt = getopt(argc, argv, "j:C:o:p:")) != -1) {
+		switch (opt) {
+		case 'j': jobs = atoi(optarg); break;
+		case 'C':
+			if (rv32i_config_load(&base, optarg) < 0) {
+				fprintf(stderr, "Cannot read %s\n", optarg);
+				exit(1);
+			}
+			break;
+		case 'o': results = optarg; break;
+		case 'p': {
+			struct param* p = &sw.param[sw.params];
+			char* eq = strchr(optarg, '=');
+			if (sw.params == PARAM_MAX || !eq) usage(argv[0]);
+			p->key = strndup(optarg, eq - optarg);
+			for (char* v = strtok(eq + 1, ","); v && p->values < VALUE_MAX; v = strtok(NULL, ",")) {
+				struct rv32i_config check = base;
+				if (rv32i_config_set(&check, p->key, v) < 0) {
+					fprintf(stderr, "Bad parameter %s=%s\n", p->key, v);
+					exit(1);
+				}
+				p->value[p->values++] = strdup(v);
+			}
+			if (p->values) sw.params++;
+			break;
+		}
+		default: usage(argv[0]); break;
+		}
+	}
+	if (optind == argc) usage(argv[0]);
+	if (jobs < 1) jobs = 1;
+	sw.workload = argv + optind;
+	sw.workloads = argc - optind;
+
+	// points: the first parameter varies slowest
+	int points = 1;
+	for (i = 0; i < sw.params; i++) points *= sw.param[i].values;
+	sw.runs = points * sw.workloads;
+	sw.run = (struct run*)calloc(sw.runs, sizeof(struct run));
+	for (i = 0; i < sw.runs; i++) {
+		struct run* r = &sw.run[i];
+		r->point = i / sw.workloads;
+		r->workload = i % sw.workloads;
+		r->cfg = base;
+		for (j = sw.params - 1, opt = r->point; j >= 0; opt /= sw.param[j].values, j--) {
+			rv32i_config_set(&r->cfg, sw.param[j].key, sw.param[j].value[opt % sw.param[j].values]);
+		}
+	}
+
+	if (jobs > sw.runs) jobs = sw.runs;
+	pthread_t* thread = (pthread_t*)calloc(jobs, sizeof(pthread_t));
+	pthread_mutex_init(&sw.lock, NULL);
+	double t = now();
+	for (i = 0; i < jobs; i++) pthread_create(&thread[i], NULL, worker, &sw);
+	for (i = 0; i < jobs; i++) pthread_join(thread[i], NULL);
+	t = now() - t;
+
+	FILE* fp = results ? fopen(results, "w") : stdout;
+	if (!fp) {
+		fprintf(stderr, "Cannot create %s\n", results);
+		exit(1);
+	}
+	fprintf(fp, "workload");
+	for (i = 0; i < sw.params; i++) fprintf(fp, "\t%s", sw.param[i].key);
+	fprintf(fp, "\tcycles\tretired\tcpi\tstall\tflush\tidle\tfused\texit\tmatch\tseconds\n");
+
+	int failed = 0;
+	for (i = 0; i < sw.runs; i++) {
+		struct run* r = &sw.run[i];
+		fprintf(fp, "%s", sw.workload[r->workload]);
+		for (j = 0, opt = r->point; j < sw.params; j++) {
+			int stride = 1;
+			for (int k = j + 1; k < sw.params; k++) stride *= sw.param[k].values;
+			fprintf(fp, "\t%s", sw.param[j].value[(r->point / stride) % sw.param[j].values]);
+		}
+		if (r->error < 0) {
+			fprintf(fp, "\t-\t-\t-\t-\t-\t-\t-\t%s\t-\t-\n", (r->error == RV32I_ERR_OPEN) ? "open" : (r->error == RV32I_ERR_RANGE) ? "range" : "format");
+			failed++;
+			continue;
+		}
+		fprintf(fp, "\t%llu\t%llu\t%.3f\t%llu\t%llu\t%llu\t%llu", (unsigned long long)r->stats.cycles, (unsigned long long)r->stats.retired,
+			r->stats.retired ? (double)r->stats.cycles / r->stats.retired : 0.0,
+			(unsigned long long)r->stats.stall, (unsigned long long)r->stats.flush, (unsigned long long)r->stats.idle, (unsigned long long)r->stats.fused);
+		if (r->exited) fprintf(fp, "\t%d", r->code);
+		else fprintf(fp, "\t-");
+		fprintf(fp, "\t%s\t%.3f\n", (r->match < 0) ? "-" : r->match ? "yes" : "NO", r->seconds);
+		if (r->match == 0) failed++;
+	}
+	if (results) fclose(fp);
+
+	fprintf(stderr, "%d runs (%d points x %d workloads) on %d threads in %.3f s, %d failed\n", sw.runs, points, sw.workloads, jobs, t, failed);
+
+	for (i = 0; i < sw.params; i++) {
+		free(sw.param[i].key);
+		for (j = 0; j < sw.param[i].values; j++) free(sw.param[i].value[j]);
+	}
+	free(sw.run);
+	free(thread);
+	pthread_mutex_destroy(&sw.lock);
+
+	return failed != 0;
+}
@@ -0,0 +1,283 @@
+/* **************************************
+ * Module: engine regression tests
+ *
+ * - Short hand-assembled programs with a known outcome, one per fixed bug
+ * - Every case runs on every engine with an imem of PROG_MAX words, its
+ *   registers are checked when it has reached the final jump to itself
+ *   or run past the end of imem
+ * - The lr/sc/amo cases run on a deterministic SMP_HARTS-hart system,
+ *   every hart is checked
+ * - On every pipeline configuration, each case also runs with the stage
+ *   latches in a random order (rv32i_pipeline_shuffle) and must end in the
+ *   state of the fixed order: registers, dmem, pc and statistics
+ * - Instruction words whose mnemonic the decoder got wrong are checked
+ *   against rv32i_inst_name()
+ * - ecall returns a7 * 2 in a0
+ * - make test runs them, the exit code is nonzero if a case failed
+ *
+ * Author: Dongkyun Lim (sts08015@korea.ac.kr)
+ *
+ * **************************************
+ */
+
+#include "rv32i_core.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define RUN_CYCLES 200	// every case is done long before, and past the end of imem
+#define PROG_MAX 32
+#define EXPECT_MAX 8
+#define SMP_HARTS 2
+#define SHUFFLE_SEED 0x2545f491
+#define PIPELINE_CONFIGS 48	// forwarding x flush_opt x branch_stage x fusion x byte_lanes
+
+struct expect {
+	int reg;			// x1-x31, 0 ends the list
+	uint32_t value;
+};
+
+struct test {
+	const char* name;
+	uint32_t prog[PROG_MAX];
+	struct expect reg[EXPECT_MAX];
+};
+
+static const struct test tests[] = {
+	{ "auipc adds the upper immediate to pc",
+		{
+		0x00000013,	// nop
+		0x00001097,	// auipc x1, 1
+		0xfffff117,	// auipc x2, 0xfffff
+		0x00002197,	// auipc x3, 2
+		0x00418213,	// addi x4, x3, 4
+		0x0000006f,	// jal x0, 0
+		},
+		{ { 1, 0x00001004 }, { 2, 0xfffff008 }, { 3, 0x0000200c }, { 4, 0x00002010 } } },
+	{ "fused pairs compute what their two instructions do",
+		{
+		0x123450b7,	// lui x1, 0x12345
+		0x67808093,	// addi x1, x1, 0x678
+		0x00000197,	// auipc x3, 0
+		0x0011ac23,	// sw x1, 24(x3)
+		0x00000117,	// auipc x2, 0
+		0x01012103,	// lw x2, 16(x2)
+		0x01009213,	// slli x4, x1, 16
+		0x01025213,	// srli x4, x4, 16
+		0x00000297,	// auipc x5, 0
+		0x00c282e7,	// jalr x5, 12(x5)
+		0x00100313,	// addi x6, x0, 1
+		0x0000006f,	// jal x0, 0
+		},
+		{ { 1, 0x12345678 }, { 2, 0x12345678 }, { 3, 0x00000008 }, { 4, 0x00005678 }, { 5, 0x00000028 }, { 6, 0 } } },
+	{ "loads outside dmem read 0, stores there are dropped",
+		{
+		0x05500093,	// addi x1, x0, 0x55
+		0x00001137,	// lui x2, 0x1			first word past the default dmem
+		0xfe112e23,	// sw x1, -4(x2)
+		0x00112023,	// sw x1, 0(x2)
+		0x00010237,	// lui x4, 0x10
+		0x00122023,	// sw x1, 0(x4)
+		0x00012183,	// lw x3, 0(x2)
+		0x00022283,	// lw x5, 0(x4)
+		0xffc12303,	// lw x6, -4(x2)
+		0x0000006f,	// jal x0, 0
+		},
+		{ { 3, 0 }, { 5, 0 }, { 6, 0x00000055 } } },
+	{ "ebreak halts after the older instructions",
+		{
+		0x00100093,	// addi x1, x0, 1
+		0x00200113,	// addi x2, x0, 2
+		0x00100073,	// ebreak
+		0x00300193,	// addi x3, x0, 3
+		0x0000006f,	// jal x0, 0
+		},
+		{ { 1, 1 }, { 2, 2 }, { 3, 0 } } },
+	{ "ecall sees the older instructions' results, the younger ones see its",
+		{
+		0x01500893,	// addi x17, x0, 21
+		0x00000073,	// ecall
+		0x00150293,	// addi x5, x10, 1
+		0x0000006f,	// jal x0, 0
+		},
+		{ { 10, 42 }, { 5, 43 } } },
+	{ "fetch past the end of imem reads nops",
+		{
+		0x00100093,	// addi x1, x0, 1
+		0x00200113,	// addi x2, x0, 2
+		},
+		{ { 1, 1 }, { 2, 2 } } },
+	{ "andi with a negative immediate keeps every bit",
+		{
+		0xfab00113,	// addi x2, x0, -0x55
+		0xfff17093,	// andi x1, x2, -1
+		0xff817193,	// andi x3, x2, -8
+		0x0000006f,	// jal x0, 0
+		},
+		{ { 1, 0xffffffab }, { 3, 0xffffffa8 } } },
+};
+
+struct name {
+	uint32_t inst;
+	const char* name;
+};
+
+static const struct name names[] = {
+	{ 0xfff17093, "andi" },	// andi x1, x2, -1: the immediate's top bits aren't a funct7
+	{ 0x00017093, "andi" },	// andi x1, x2, 0
+};
+
+static const struct test smp_tests[] = {
+	{ "sc outside dmem fails and drops the reservation",
+		{
+		0x05500093,	// addi x1, x0, 0x55
+		0x00001137,	// lui x2, 0x1			first word past the default dmem
+		0x1000222f,	// lr.w x4, (x0)
+		0x181121af,	// sc.w x3, x1, (x2)
+		0x181022af,	// sc.w x5, x1, (x0)
+		0x100120af,	// lr.w x1, (x2)
+		0x0000006f,	// jal x0, 0
+		},
+		{ { 1, 0 }, { 3, 1 }, { 4, 0 }, { 5, 1 } } },
+};
+
+static void ecall(void* arg, rv32i_core* core, uint32_t pc)
+{
+	(void)arg;
+	(void)pc;
+	rv32i_set_reg(core, 10, rv32i_get_reg(core, 17) * 2);
+}
+
+// returns the number of mismatching registers
+static int check(const struct test* t, rv32i_core* core, const char* where)
+{
+	int i, failed = 0;
+
+	for (i = 0; i < EXPECT_MAX && t->reg[i].reg; i++) {
+		uint32_t value = rv32i_get_reg(core, t->reg[i].reg);
+		if (value == t->reg[i].value) continue;
+		printf("FAIL %s (%s): x%d = %08X, expected %08X\n", t->name, where, t->reg[i].reg, value, t->reg[i].value);
+		failed++;
+	}
+	return failed;
+}
+
+static int run(const struct test* t, enum rv32i_engine engine)
+{
+	struct rv32i_config cfg;
+	rv32i_config_init(&cfg, engine);
+	cfg.imem_depth = PROG_MAX;
+	rv32i_core* core = rv32i_create_config(&cfg);
+	int words = PROG_MAX, failed;
+
+	while (words > 0 && !t->prog[words - 1]) words--;
+	rv32i_load_words(core, RV32I_IMEM, t->prog, words);
+	rv32i_set_ecall_cb(core, ecall, NULL);
+	rv32i_step(core, RUN_CYCLES);
+	failed = check(t, core, rv32i_engine_name(engine));
+
+	rv32i_destroy(core);
+	return failed;
+}
+
+static rv32i_core* pipeline_run(const struct test* t, int config, uint32_t seed)
+{
+	struct rv32i_config cfg;
+	rv32i_config_init(&cfg, RV32I_PIPELINE);
+	cfg.imem_depth = PROG_MAX;
+	cfg.forwarding = config & 1;
+	cfg.flush_opt = (config >> 1) & 1;
+	cfg.fusion = (config >> 2) & 1;
+	cfg.byte_lanes = (config >> 3) & 1;
+	cfg.branch_stage = RV32I_STAGE_ID + config / 16;
+	rv32i_core* core = rv32i_create_config(&cfg);
+	int words = PROG_MAX;
+
+	while (words > 0 && !t->prog[words - 1]) words--;
+	rv32i_load_words(core, RV32I_IMEM, t->prog, words);
+	rv32i_set_ecall_cb(core, ecall, NULL);
+	rv32i_pipeline_shuffle(core, seed);
+	rv32i_step(core, RUN_CYCLES);
+	return core;
+}
+
+// returns 1 if the stages latched in a random order end anywhere else than in the fixed order
+static int run_shuffled(const struct test* t, int config)
+{
+	rv32i_core* fixed = pipeline_run(t, config, 0);
+	rv32i_core* shuffled = pipeline_run(t, config, SHUFFLE_SEED + config);
+	struct rv32i_stats a, b;
+	const char* what = NULL;
+	uint32_t i;
+
+	rv32i_get_stats(fixed, &a);
+	rv32i_get_stats(shuffled, &b);
+	for (i = 1; i < 32 && !what; i++)
+		if (rv32i_get_reg(fixed, i) != rv32i_get_reg(shuffled, i)) what = "registers";
+	for (i = 0; i < rv32i_get_config(fixed)->dmem_depth && !what; i++)
+		if (rv32i_read_mem(fixed, RV32I_DMEM, i << 2) != rv32i_read_mem(shuffled, RV32I_DMEM, i << 2)) what = "dmem";
+	if (!what && rv32i_get_pc(fixed) != rv32i_get_pc(shuffled)) what = "pc";
+	if (!what && (a.cycles != b.cycles || a.retired != b.retired || a.stall != b.stall || a.flush != b.flush)) what = "statistics";
+	if (what) printf("FAIL %s (pipeline config %d, shuffled): %s differ\n", t->name, config, what);
+
+	rv32i_destroy(fixed);
+	rv32i_destroy(shuffled);
+	return what != NULL;
+}
+
+// returns 1 if the decoder names inst otherwise
+static int check_name(const struct name* n)
+{
+	const char* name = rv32i_inst_name(n->inst);
+	if (strcmp(name, n->name) == 0) return 0;
+	printf("FAIL %08X decodes as %s, expected %s\n", n->inst, name, n->name);
+	return 1;
+}
+
+static int run_smp(const struct test* t)
+{
+	rv32i_smp* smp = rv32i_smp_create(SMP_HARTS);
+	int words = PROG_MAX, failed = 0, h;
+	char where[16];
+
+	while (words > 0 && !t->prog[words - 1]) words--;
+	rv32i_load_words(rv32i_smp_hart(smp, 0), RV32I_IMEM, t->prog, words);
+	rv32i_smp_reset(smp);
+	rv32i_smp_set_deterministic(smp, 1);
+	rv32i_smp_run(smp, RUN_CYCLES);
+
+	for (h = 0; h < SMP_HARTS; h++) {
+		snprintf(where, sizeof(where), "hart %d", h);
+		failed += check(t, rv32i_smp_hart(smp, h), where);
+	}
+
+	rv32i_smp_destroy(smp);
+	return failed;
+}
+
+int main(void) {
+
+	int cases = sizeof(tests) / sizeof(tests[0]), smp_cases = sizeof(smp_tests) / sizeof(smp_tests[0]), runs = 0, failed = 0, i, e;
+
+	for (i = 0; i < cases; i++)
+		for (e = 0; e < RV32I_ENGINE_NUM; e++) {
+			if (run(&tests[i], (enum rv32i_engine)e)) failed++;
+			runs++;
+		}
+	for (i = 0; i < cases; i++)
+		for (e = 0; e < PIPELINE_CONFIGS; e++) {
+			if (run_shuffled(&tests[i], e)) failed++;
+			runs++;
+		}
+	for (i = 0; i < smp_cases; i++) {
+		if (run_smp(&smp_tests[i])) failed++;
+		runs++;
+	}
+	for (i = 0; i < (int)(sizeof(names) / sizeof(names[0])); i++) {
+		if (check_name(&names[i])) failed++;
+		runs++;
+	}
+	cases += smp_cases;
+
+	printf("%d runs of %d cases, %d failed\n", runs, cases, failed);
+	return failed != 0;
+}
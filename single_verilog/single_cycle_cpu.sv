@@ -43,202 +43,39 @@ module single_cycle_cpu
     logic           mem_read, mem_write;
 
     // -------------------------------------------------------------------
-    /* Main control unit:
-     * Main control unit generates control signals for datapath elements
-     * The control signals are determined by decoding instructions
+    /* Decoder:
+     * Main control unit, ALU control unit and immediate generator
+     * (decoder.sv is generated from isa/rv32i.isa)
      */
     logic   [6:0]   opcode;
     logic   [6:0]   branch;
     logic           alu_src, mem_to_reg;
     logic   [1:0]   alu_op;
     logic   [2:0]   funct3;
-    
-    assign opcode = inst[6:0];
-    assign funct3 = inst[14:12];
-
-    always_comb begin
-        if(opcode == 7'b1100011) begin  //conditional branch
-            branch[0] = (funct3 == 3'b000);    //beq
-            branch[1] = (funct3 == 3'b001);    //bne
-            branch[2] = (funct3 == 3'b100);    //blt
-            branch[3] = (funct3 == 3'b101);    //bge
-            branch[4] = (funct3 == 3'b110);    //bltu
-            branch[5] = (funct3 == 3'b111);    //bgeu
-        end
-        else if(opcode == 7'b1101111 || opcode == 7'b1100111) begin    //unconditional branch (jal, jalr)
-            branch[6] = 1'b1;
-        end
-        else begin
-            branch = 7'b0;
-        end
-    end
-
-    assign mem_read = (opcode == 7'b0000011);    // ld
-    assign mem_write = (opcode == 7'b0100011);   // sd
-    assign mem_to_reg = (opcode == 7'b0000011);   //ld
-    assign reg_write = (opcode == 7'b0000011||opcode == 7'b0110011||opcode == 7'b0010011||opcode == 7'b1100111||opcode == 7'b1101111||opcode == 7'b0110111||opcode == 7'b0010111);
-    assign alu_src = (opcode == 7'b0000011||opcode == 7'b0100011||opcode == 7'b0010011||opcode == 7'b1100111||opcode == 7'b1101111||opcode == 7'b0010111);
-
-    always_comb begin
-        case(opcode)
-            7'b0000011: begin    //loads
-                alu_op = 2'b00;
-            end
-            7'b0100011: begin    //stores
-                alu_op = 2'b00;
-            end
-            7'b1100011: begin    //conditinal branches
-                alu_op = 2'b01;
-            end
-            7'b0110011: begin    //rtype
-                alu_op = 2'b10;
-            end
-            7'b0010011: begin   //itype
-                alu_op = 2'b11;
-            end
-            7'b1101111: begin   //jal
-                alu_op = 2'b00;
-            end
-            7'b1100111: begin   //jalr
-                alu_op = 2'b00;
-            end
-            7'b0010111: begin   //auipc
-                alu_op = 2'b00;
-            end
-            default: begin
-                alu_op = 2'b00;
-            end
-        endcase
-    end
-
-    /* ALU control unit:
-     * ALU control unit generate alu_control signal which selects ALU operations
-     * Generating control signals using alu_op, funct7, and funct3 fields
-     */
     logic   [6:0]   funct7;
-
-    assign funct7 = inst[REG_WIDTH-1:25];
-    logic slt;
-    always_comb begin
-        if(alu_op == 2'b00) begin
-            alu_control = 4'b0010;  //add
-            slt = 1'b0;
-        end
-        else if(alu_op == 2'b01) begin  //conditional branches
-            alu_control = 4'b0110;      //sub --> to compare
-            slt = 1'b0;
-        end
-        else begin
-            if(funct3 == 3'd0 && ((alu_op == 2'b10 && funct7 == 7'd0) || (alu_op == 2'b11))) begin  //add
-                alu_control = 4'b0010;
-                slt = 1'b0;
-            end
-            else if(funct3 == 3'd0 && funct7 == 7'b0100000) begin //sub
-                alu_control = 4'b0110;
-                slt = 1'b0;
-            end
-            else if(funct3 == 3'b111 && funct7 == 7'd0) begin   //and
-                alu_control = 4'b0000;
-                slt = 1'b0;
-            end
-            else if(funct3 == 3'b110) begin   //or
-                alu_control = 4'b0001;
-                slt = 1'b0;
-            end
-            else if(funct3 == 3'b100) begin   //xor
-                alu_control = 4'b0011;
-                slt = 1'b0;
-            end
-            else if(funct3 == 3'b001 && funct7 == 7'd0) begin   //shift left
-                alu_control = 4'b0111;
-                slt = 1'b0;
-            end
-            else if(funct3 == 3'b101 && funct7 == 7'd0) begin   //shift right
-                alu_control = 4'b1000;
-                slt = 1'b0;
-            end
-            else if(funct3 == 3'b101 && funct7 == 7'b0100000) begin //shift right arithmetic
-                alu_control = 4'b1001;
-                slt = 1'b0;
-            end
-            else if(funct3 == 3'b010 || funct3 == 3'b011) begin //set less than
-                alu_control = 4'b0110;
-                slt = 1'b1;
-            end
-        end
-    end
-
-    /* Immediate generator:
-     * Generating immediate value from inst[31:0]
-     */
+    logic           slt;
     logic   [REG_WIDTH-1:0]  imm32;
     logic   [REG_WIDTH-1:0]  imm32_branch;  // imm32 left shifted by 1
-    logic   [11:0]  imm12;  // 12-bit immediate value extracted from inst
-    logic   [19:0]  imm20;  // 20-bit immediate value --> for unconditional branch, upper immediate
-    logic   imm_flag;
-
-    always_comb begin
-        case(opcode)
-            7'b0000011: begin   //ld
-                imm12 = inst[31:20];
-                imm_flag = 1'b1;
-            end
-            7'b0100011: begin   //sd
-                imm12[11:5] = inst[31:25];
-                imm12[4:0] = inst[11:7];
-                imm_flag = 1'b1;
-            end
-            7'b0010011: begin   //i-type
-                imm12 = inst[31:20];
-                if(funct3 == 3'b101) begin    //slli, srli, srai
-                    imm12 = {7'd0,imm12[4:0]};
-                end
-                imm_flag = 1'b1;
-            end
-            7'b1100011: begin   //conditional branch
-                imm12[11] = inst[31];
-                imm12[9:4] = inst[30:25];
-                imm12[3:0] = inst[11:8];
-                imm12[10] = inst[7];
-                imm_flag = 1'b1;
-            end
-            7'b1101111: begin //unconditional branch - jal
-                imm20[19] = inst[31];
-                imm20[9:0] = inst[30:21];
-                imm20[10] = inst[20];
-                imm20[18:11] = inst[19:12];
-                imm_flag = 1'b0;
-            end
-            7'b1100111: begin   //unconditional branch - jalr
-                imm12 = inst[31:20];
-                imm_flag = 1'b1;
-            end
-            7'b0010111: begin   //auipc
-                imm20 = inst[31:12];
-                imm_flag = 1'b0;
-            end
-            7'b0110111: begin   //lui
-                imm20 = inst[31:12];
-                imm_flag = 1'b0;
-            end
-            
-            default: begin
-            end
-        endcase
-    end
 
-    always_comb begin
-        if(imm_flag) begin
-            if((opcode == 7'b0010011 && funct3 == 3'b011) && (opcode == 7'b1100011 && (funct3 == 3'b110 || funct3 == 3'b111))) begin
-                imm32 = {20'd0,imm12};         //bit extension (unsigned)
-            end
-            else begin
-                imm32 = {{20{imm12[11]}},imm12};    //sign extension
-            end
-        end else begin
-            imm32 = {{12{imm20[19]}},imm20};    //sign extension
-        end
-    end
+    decoder u_decoder_0 (
+        .inst           (inst),
+        .opcode         (opcode),
+        .funct3         (funct3),
+        .funct7         (funct7),
+        .rs1            (rs1),
+        .rs2            (rs2),
+        .rd             (rd),
+        .imm32          (imm32),
+        .branch         (branch),
+        .alu_src        (alu_src),
+        .alu_op         (alu_op),
+        .alu_control    (alu_control),
+        .slt            (slt),
+        .mem_read       (mem_read),
+        .mem_write      (mem_write),
+        .mem_to_reg     (mem_to_reg),
+        .reg_write      (reg_write)
+    );
     
     // Program counter
     logic   [31:0]  pc_curr, pc_next;
@@ -297,7 +134,7 @@ module single_cycle_cpu
 
     // ALU inputs
     assign alu_in1 = ((branch[6] && opcode == 7'b1101111) || opcode == 7'b0010111) ? pc_curr : rs1_dout;
-    assign alu_in2 = alu_src ? imm32 : rs2_dout;
+    assign alu_in2 = (opcode == 7'b0010111) ? {imm32[19:0], 12'd0} : alu_src ? imm32 : rs2_dout;   // auipc: imm32 is the upper immediate like lui's
 
     // RF din
     always_comb begin
@@ -340,11 +177,6 @@ module single_cycle_cpu
     // imem
     assign imem_addr = pc_curr[IMEM_ADDR_WIDTH+1:2];    //32bit-imem
     
-    // regfile
-    assign rs1 = inst[19:15];
-    assign rs2 = inst[24:20];
-    assign rd = inst[11:7];
-
     // dmem
     assign dmem_addr = alu_result[DMEM_ADDR_WIDTH+1:2]; //32bit-dmem
     always_comb begin